@@ -0,0 +1,21 @@
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "convex_hull.hpp"
+#include "point.hpp"
+
+using namespace std;
+using namespace sapphre15::geometry;
+
+int main() {
+    int n;
+    cin >> n;
+    vector<Point> buff(n);
+    for (auto &p : buff) cin >> p;
+    vector<Point> ans = convex_hull_points(buff, true);
+    printf("%d\n", int(ans.size()));
+    for (const Point &p : ans) {
+        printf("%d %d\n", int(lround(p.x())), int(lround(p.y())));
+    }
+}
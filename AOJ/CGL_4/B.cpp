@@ -0,0 +1,20 @@
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include "point.hpp"
+#include "polygon.hpp"
+#include "rotating_calipers.hpp"
+
+using namespace std;
+using namespace sapphre15::geometry;
+
+int main() {
+    int n;
+    cin >> n;
+    vector<Point> buff(n);
+    for (auto &p : buff) cin >> p;
+    printf("%.10f\n", sqrt(get<2>(convex_diameter(Polygon(buff)))));
+}
@@ -0,0 +1,27 @@
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+#include "convex_cut.hpp"
+#include "line.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+using namespace std;
+using namespace sapphre15::geometry;
+
+int main() {
+    int n;
+    cin >> n;
+    vector<Point> buff(n);
+    for (auto &p : buff) cin >> p;
+    Polygon pl(buff);
+    int     q;
+    cin >> q;
+    while (q--) {
+        Point a, b;
+        cin >> a >> b;
+        auto cut = convex_cut(pl, Line(a, b));
+        printf("%.10f\n", cut ? cut->area() : 0.0);
+    }
+}
@@ -0,0 +1,19 @@
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <tuple>
+#include <vector>
+
+#include "closest_pair.hpp"
+#include "point.hpp"
+
+using namespace std;
+using namespace sapphre15::geometry;
+
+int main() {
+    int n;
+    cin >> n;
+    vector<Point> buff(n);
+    for (auto &p : buff) cin >> p;
+    printf("%.10f\n", sqrt(get<2>(closest_pair(buff))));
+}
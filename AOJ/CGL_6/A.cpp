@@ -0,0 +1,25 @@
+#include <cstdio>
+#include <vector>
+
+#include "manhattan_intersection.hpp"
+#include "point.hpp"
+#include "segment.hpp"
+
+using namespace std;
+using namespace sapphre15::geometry;
+
+using PointI   = BasicPoint<int>;
+using SegmentI = BasicSegment<int>;
+
+int main() {
+    int n;
+    scanf("%d", &n);
+    vector<SegmentI> s;
+    s.reserve(n);
+    for (int i = 0; i < n; i++) {
+        int x1, y1, x2, y2;
+        scanf("%d %d %d %d", &x1, &y1, &x2, &y2);
+        s.emplace_back(PointI(x1, y1), PointI(x2, y2));
+    }
+    printf("%lld\n", count_manhattan_intersections(s));
+}
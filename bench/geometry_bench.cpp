@@ -0,0 +1,408 @@
+#include <benchmark/benchmark.h>
+
+#include <affine_transform.hpp>
+#include <algorithm>
+#include <circle.hpp>
+#include <cmath>
+#include <config.hpp>
+#include <cross_point.hpp>
+#include <delaunay.hpp>
+#include <distance.hpp>
+#include <half_plane_intersection.hpp>
+#include <intersection.hpp>
+#include <kd_tree.hpp>
+#include <line.hpp>
+#include <manhattan_intersection.hpp>
+#include <point.hpp>
+#include <point_buffer.hpp>
+#include <polygon.hpp>
+#include <random>
+#include <robust_predicate.hpp>
+#include <segment.hpp>
+#include <tangent.hpp>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 入力の種類
+enum Input {
+    RANDOM     = 0,  // [-100, 100]^2 の一様乱数
+    DEGENERATE = 1,  // ほぼ一直線上に並ぶ点
+    LARGE      = 2,  // [-1e9, 1e9]^2 の一様乱数
+};
+
+const char *input_name(int kind) {
+    switch (kind) {
+        case RANDOM:
+            return "random";
+        case DEGENERATE:
+            return "degenerate";
+        default:
+            return "large";
+    }
+}
+
+// 種類 kind の点を n 個生成する
+vector<Point> make_points(size_t n, int kind, unsigned seed = 1) {
+    mt19937_64                  rng(seed);
+    uniform_real_distribution<> unit(-1.0, 1.0);
+    vector<Point>               ret(n);
+    for (Point &p : ret) {
+        Real x = unit(rng), y = unit(rng);
+        switch (kind) {
+            case RANDOM:
+                p = Point(100 * x, 100 * y);
+                break;
+            case DEGENERATE:
+                // y = 0.5x + 1 上の点。丸め誤差でわずかにずれる
+                p = Point(100 * x, 0.5 * (100 * x) + 1.0);
+                break;
+            default:
+                p = Point(1e9 * x, 1e9 * y);
+                break;
+        }
+    }
+    return ret;
+}
+
+// 種類 kind に応じた大きさの円を n 個生成する
+vector<Circle> make_circles(size_t n, int kind, unsigned seed = 1) {
+    vector<Point>               c = make_points(n, kind, seed);
+    mt19937_64                  rng(seed + 1);
+    uniform_real_distribution<> unit(0.1, 1.0);
+    Real                        scale = kind == LARGE ? 1e9 : 100.0;
+    vector<Circle>              ret;
+    ret.reserve(n);
+    for (const Point &p : c) ret.emplace_back(p, scale * unit(rng));
+    return ret;
+}
+
+// 頂点数 n の星形多角形
+Polygon make_polygon(size_t n, int kind) {
+    mt19937_64                  rng(n);
+    uniform_real_distribution<> unit(0.5, 1.0);
+    Real                        scale = kind == LARGE ? 1e9 : 100.0;
+    vector<Point>               v(n);
+    for (size_t i = 0; i < n; i++) {
+        // DEGENERATE では頂点が円周上に並び，隣接辺がほぼ一直線になる
+        Real r = kind == DEGENERATE ? 1.0 : unit(rng);
+        v[i]   = Point::polar(2 * PI * i / n, scale * r);
+    }
+    return Polygon(v);
+}
+
+void set_counters(benchmark::State &state, size_t items) {
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(items));
+    state.SetLabel(input_name(int(state.range(1))));
+}
+
+template <class Predicate>
+void BM_ccw(benchmark::State &state) {
+    size_t        n = state.range(0);
+    vector<Point> p = make_points(n + 2, int(state.range(1)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            benchmark::DoNotOptimize(ccw<Predicate>(p[i], p[i + 1], p[i + 2]));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK_TEMPLATE(BM_ccw, EpsilonPredicate)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+BENCHMARK_TEMPLATE(BM_ccw, ExactPredicate)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_ccwPointBuffer(benchmark::State &state) {
+    size_t            n = state.range(0);
+    vector<Point>     p = make_points(n + 2, int(state.range(1)));
+    PointBuffer       buf(p);
+    vector<ClockWise> out(buf.size());
+    for (auto _ : state) {
+        ccw(p[0], p[1], buf, out.data());
+        benchmark::ClobberMemory();
+    }
+    set_counters(state, buf.size());
+}
+BENCHMARK(BM_ccwPointBuffer)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_crossPointLineLine(benchmark::State &state) {
+    size_t                   n = state.range(0);
+    vector<Point>            p = make_points(4 * n, int(state.range(1)));
+    vector<pair<Line, Line>> l;
+    for (size_t i = 0; i < n; i++) {
+        // DEGENERATE では点が一直線上にあるので，少しずらしてほぼ平行にする
+        Line a(p[4 * i], p[4 * i + 1]),
+            b(p[4 * i + 2], p[4 * i + 3] + Point(0.0, 1e-3));
+        // 平行な直線の交点は求められないので除く
+        if (!parallel(a, b)) l.emplace_back(a, b);
+    }
+    for (auto _ : state) {
+        for (const auto &ab : l) {
+            benchmark::DoNotOptimize(cross_point(ab.first, ab.second));
+        }
+    }
+    set_counters(state, l.size());
+}
+BENCHMARK(BM_crossPointLineLine)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_crossPointCircleLine(benchmark::State &state) {
+    size_t         n = state.range(0);
+    vector<Circle> c = make_circles(n, int(state.range(1)));
+    vector<Point>  p = make_points(2 * n, int(state.range(1)), 2);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            Line l(p[2 * i], p[2 * i + 1]);
+            benchmark::DoNotOptimize(cross_point(c[i], l));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_crossPointCircleLine)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_crossPointCircleCircle(benchmark::State &state) {
+    size_t         n = state.range(0);
+    vector<Circle> c = make_circles(n + 1, int(state.range(1)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            benchmark::DoNotOptimize(cross_point(c[i], c[i + 1]));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_crossPointCircleCircle)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_intersectionSegmentSegment(benchmark::State &state) {
+    size_t        n = state.range(0);
+    vector<Point> p = make_points(2 * n + 2, int(state.range(1)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            Segment a(p[2 * i], p[2 * i + 1]), b(p[2 * i + 1], p[2 * i + 3]);
+            benchmark::DoNotOptimize(intersection(a, b));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_intersectionSegmentSegment)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_distanceSegmentSegment(benchmark::State &state) {
+    size_t        n = state.range(0);
+    vector<Point> p = make_points(2 * n + 2, int(state.range(1)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            Segment a(p[2 * i], p[2 * i + 1]), b(p[2 * i + 2], p[2 * i + 3]);
+            benchmark::DoNotOptimize(distance(a, b));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_distanceSegmentSegment)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_polygonInside(benchmark::State &state) {
+    const size_t  queries = 256;
+    Polygon       pl      = make_polygon(state.range(0), int(state.range(1)));
+    vector<Point> q       = make_points(queries, int(state.range(1)), 3);
+    for (auto _ : state) {
+        for (const Point &p : q) benchmark::DoNotOptimize(pl.inside(p));
+    }
+    set_counters(state, queries);
+}
+BENCHMARK(BM_polygonInside)
+    ->ArgsProduct({benchmark::CreateRange(1 << 4, 1 << 12, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_polygonArea(benchmark::State &state) {
+    Polygon pl = make_polygon(state.range(0), int(state.range(1)));
+    for (auto _ : state) benchmark::DoNotOptimize(pl.area());
+    set_counters(state, state.range(0));
+}
+BENCHMARK(BM_polygonArea)
+    ->ArgsProduct({benchmark::CreateRange(1 << 4, 1 << 12, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_manhattanIntersections(benchmark::State &state) {
+    // 水平と垂直の線分を交互に並べる。LARGE では座標の範囲を広げる
+    size_t          n = state.range(0);
+    vector<Point>   p = make_points(2 * n, int(state.range(1)));
+    vector<Segment> s;
+    s.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        const Point &a = p[2 * i], &b = p[2 * i + 1];
+        if (i % 2 == 0)
+            s.emplace_back(a, Point(b.x(), a.y()));
+        else
+            s.emplace_back(a, Point(a.x(), b.y()));
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(count_manhattan_intersections(s));
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_manhattanIntersections)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_kdTreeNearest(benchmark::State &state) {
+    const size_t  queries = 256;
+    vector<Point> p       = make_points(state.range(0), int(state.range(1)));
+    vector<Point> q       = make_points(queries, int(state.range(1)), 3);
+    KdTree        tree(p);
+    for (auto _ : state) {
+        for (const Point &r : q) benchmark::DoNotOptimize(tree.nearest(r));
+    }
+    set_counters(state, queries);
+}
+BENCHMARK(BM_kdTreeNearest)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+template <class Predicate>
+void BM_delaunay(benchmark::State &state) {
+    const size_t  n = state.range(0);
+    vector<Point> p = make_points(n, int(state.range(1)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BasicDelaunay<Real, Predicate>(p).size());
+    }
+    set_counters(state, n);
+}
+BENCHMARK_TEMPLATE(BM_delaunay, EpsilonPredicate)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+BENCHMARK_TEMPLATE(BM_delaunay, ExactPredicate)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_halfPlaneIntersection(benchmark::State &state) {
+    // 各点を通り，原点を左側に見る直線
+    const size_t  n = state.range(0);
+    vector<Point> p = make_points(n, int(state.range(1)));
+    vector<Line>  lines;
+    for (const Point &q : p) {
+        Point d = rotate(q, PI / 2);
+        lines.emplace_back(q, q + d);
+    }
+    vector<Point> out;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(half_plane_intersection(lines, out));
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_halfPlaneIntersection)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_sortByAngle(benchmark::State &state) {
+    const size_t  n = state.range(0);
+    vector<Point> p = make_points(n, int(state.range(1)));
+    vector<Point> q;
+    for (auto _ : state) {
+        q = p;
+        sort_by_angle(begin(q), end(q), Point(0.0, 0.0));
+        benchmark::DoNotOptimize(q.data());
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_sortByAngle)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+// 比較のための atan2 による偏角ソート
+void BM_sortByArg(benchmark::State &state) {
+    const size_t  n = state.range(0);
+    vector<Point> p = make_points(n, int(state.range(1)));
+    vector<Point> q;
+    for (auto _ : state) {
+        q = p;
+        sort(begin(q), end(q), [](const Point &a, const Point &b) {
+            return arg(a) < arg(b);
+        });
+        benchmark::DoNotOptimize(q.data());
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_sortByArg)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+// 比較のため点ごとに三角関数を計算する回転
+void BM_rotate(benchmark::State &state) {
+    const size_t  n = state.range(0);
+    vector<Point> p     = make_points(n, int(state.range(1)));
+    Real          theta = 0.7;
+    benchmark::DoNotOptimize(theta);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            benchmark::DoNotOptimize(rotate(p[i], theta));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_rotate)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_affineTransform(benchmark::State &state) {
+    const size_t    n = state.range(0);
+    PointBuffer     p(make_points(n, int(state.range(1)))), out;
+    AffineTransform f = AffineTransform::rotation(0.7);
+    for (auto _ : state) {
+        f(p, out);
+        benchmark::DoNotOptimize(out.x_data());
+        benchmark::DoNotOptimize(out.y_data());
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_affineTransform)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 16, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_circleThreePoints(benchmark::State &state) {
+    size_t        n = state.range(0);
+    vector<Point> p = make_points(n + 2, int(state.range(1)));
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            benchmark::DoNotOptimize(Circle(p[i], p[i + 1], p[i + 2]));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_circleThreePoints)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+void BM_tangent(benchmark::State &state) {
+    size_t         n = state.range(0);
+    vector<Circle> c = make_circles(n, int(state.range(1)));
+    vector<Point>  p = make_points(n, int(state.range(1)), 2);
+    for (auto _ : state) {
+        for (size_t i = 0; i < n; i++) {
+            benchmark::DoNotOptimize(tangent(c[i], p[i]));
+        }
+    }
+    set_counters(state, n);
+}
+BENCHMARK(BM_tangent)
+    ->ArgsProduct({benchmark::CreateRange(1 << 6, 1 << 14, 8),
+                   {RANDOM, DEGENERATE, LARGE}});
+
+}  // namespace
+
+BENCHMARK_MAIN();
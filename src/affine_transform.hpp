@@ -0,0 +1,234 @@
+#ifndef GEOMETRY_AFFINE_TRANSFORM_HPP_
+#define GEOMETRY_AFFINE_TRANSFORM_HPP_
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "circle.hpp"
+#include "config.hpp"
+#include "line.hpp"
+#include "point.hpp"
+#include "point_buffer.hpp"
+#include "polygon.hpp"
+#include "ray.hpp"
+#include "segment.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief affine transformation of the plane, stored as a 2x3 matrix
+ *   x' = a x + b y + c
+ *   y' = d x + e y + f.
+ * The sine and cosine of a rotation are calculated once when it is made,
+ * so applying it to many objects costs only multiplications.
+ * f * g is the transformation that applies g first and then f.
+ */
+template <class T>
+class BasicAffineTransform {
+   public:
+    using value_type = T;
+    using point_type = BasicPoint<T>;
+
+    // 恒等変換
+    constexpr BasicAffineTransform()
+        : _a(1), _b(0), _c(0), _d(0), _e(1), _f(0) {
+    }
+
+    constexpr BasicAffineTransform(const value_type &a,
+                                   const value_type &b,
+                                   const value_type &c,
+                                   const value_type &d,
+                                   const value_type &e,
+                                   const value_type &f)
+        : _a(a), _b(b), _c(c), _d(d), _e(e), _f(f) {
+    }
+
+    static constexpr BasicAffineTransform identity() {
+        return BasicAffineTransform();
+    }
+
+    // v だけ平行移動
+    static constexpr BasicAffineTransform translation(const point_type &v) {
+        return BasicAffineTransform(1, 0, v.x(), 0, 1, v.y());
+    }
+
+    // 原点を中心として theta だけ反時計回りに回転
+    static BasicAffineTransform rotation(const value_type &theta) {
+        const value_type c = std::cos(theta), s = std::sin(theta);
+        return BasicAffineTransform(c, -s, 0, s, c, 0);
+    }
+
+    // 点 p を中心として theta だけ反時計回りに回転
+    static BasicAffineTransform rotation(const value_type &theta,
+                                         const point_type &p) {
+        return translation(p) * rotation(theta) * translation(-p);
+    }
+
+    // 原点を中心として s 倍に拡大
+    static constexpr BasicAffineTransform scaling(const value_type &s) {
+        return scaling(s, s);
+    }
+
+    // 原点を中心として x 軸方向に sx 倍，y 軸方向に sy 倍に拡大
+    static constexpr BasicAffineTransform scaling(const value_type &sx,
+                                                  const value_type &sy) {
+        return BasicAffineTransform(sx, 0, 0, 0, sy, 0);
+    }
+
+    // 線形部分の行列式
+    constexpr value_type determinant() const {
+        return _a * _e - _b * _d;
+    }
+
+    // 回転と一様な拡大，平行移動，鏡映の組み合わせか
+    bool is_similarity() const {
+        return (eq(_a, _e) && eq(_b, -_d)) || (eq(_a, -_e) && eq(_b, _d));
+    }
+
+    /**
+     * @brief the inverse transformation.
+     * The linear part must be regular.
+     */
+    BasicAffineTransform inverse() const {
+        const value_type det = determinant();
+        assert(sgn(det) != 0);
+        const value_type a = _e / det, b = -_b / det, d = -_d / det,
+                         e = _a / det;
+        return BasicAffineTransform(
+            a, b, -(a * _c + b * _f), d, e, -(d * _c + e * _f));
+    }
+
+    // g を適用した後に this を適用する変換
+    constexpr BasicAffineTransform operator*(
+        const BasicAffineTransform &g) const {
+        return BasicAffineTransform(_a * g._a + _b * g._d,
+                                    _a * g._b + _b * g._e,
+                                    _a * g._c + _b * g._f + _c,
+                                    _d * g._a + _e * g._d,
+                                    _d * g._b + _e * g._e,
+                                    _d * g._c + _e * g._f + _f);
+    }
+
+    BasicAffineTransform &operator*=(const BasicAffineTransform &g) {
+        return *this = *this * g;
+    }
+
+    point_type operator()(const point_type &p) const {
+        return point_type(
+            internal::mul_add(_a, p.x(), internal::mul_add(_b, p.y(), _c)),
+            internal::mul_add(_d, p.x(), internal::mul_add(_e, p.y(), _f)));
+    }
+
+    BasicLine<T> operator()(const BasicLine<T> &l) const {
+        auto [p, q] = l.points();
+        return BasicLine<T>((*this)(p), (*this)(q));
+    }
+
+    BasicSegment<T> operator()(const BasicSegment<T> &s) const {
+        auto [p, q] = s.end_points();
+        return BasicSegment<T>((*this)(p), (*this)(q));
+    }
+
+    BasicRay<T> operator()(const BasicRay<T> &r) const {
+        const point_type p = r.source();
+        return BasicRay<T>((*this)(p), (*this)(p + r.direction()));
+    }
+
+    /**
+     * @brief transform the circle.
+     * Only a similarity maps a circle to a circle, so this must be one.
+     */
+    BasicCircle<T> operator()(const BasicCircle<T> &c) const {
+        assert(is_similarity());
+        return BasicCircle<T>((*this)(c.center()),
+                              c.radius() * std::sqrt(std::abs(determinant())));
+    }
+
+    /**
+     * @brief transform the polygon.
+     * The vertexes are kept in counterclockwise order even if the
+     * transformation is a reflection.
+     */
+    BasicPolygon<T> operator()(const BasicPolygon<T> &pl) const {
+        std::vector<point_type> ret(pl.size());
+        for (std::size_t i = 0; i < pl.size(); i++) ret[i] = (*this)(pl[i]);
+        return BasicPolygon<T>(ret);
+    }
+
+    /**
+     * @brief transform all the points in the buffer.
+     * The points are copied in blocks of 16 to local arrays, so that the
+     * compiler vectorizes the plain multiply-adds at -O2 without checking
+     * whether the input and output arrays overlap. fma is used
+     * only when it is a hardware instruction (__FP_FAST_FMA, e.g. with
+     * -mfma), since otherwise each call goes to the math library. So the
+     * result may differ in the last bit from transforming each point.
+     */
+    void operator()(const BasicPointBuffer<T> &p,
+                    BasicPointBuffer<T>       &out) const {
+        const std::size_t n = p.size();
+        out.resize(n);
+        const T    *px = p.x_data(), *py = p.y_data();
+        T          *ox = out.x_data(), *oy = out.y_data();
+        // 係数を局所変数に写して，出力の書き込みのたびに読み直さない
+        const BasicAffineTransform g = *this;
+        std::size_t                i = 0;
+        for (; i + BLOCK <= n; i += BLOCK) {
+            T x[BLOCK], y[BLOCK];
+            for (std::size_t j = 0; j < BLOCK; j++) {
+                x[j] = px[i + j];
+                y[j] = py[i + j];
+            }
+            g.apply(x, y, BLOCK);
+            for (std::size_t j = 0; j < BLOCK; j++) ox[i + j] = x[j];
+            for (std::size_t j = 0; j < BLOCK; j++) oy[i + j] = y[j];
+        }
+        T x[BLOCK], y[BLOCK];
+        for (std::size_t j = 0; i + j < n; j++) {
+            x[j] = px[i + j];
+            y[j] = py[i + j];
+        }
+        g.apply(x, y, n - i);
+        for (std::size_t j = 0; i + j < n; j++) {
+            ox[i + j] = x[j];
+            oy[i + j] = y[j];
+        }
+    }
+
+    // バッファ内の点をその場で変換する
+    void operator()(BasicPointBuffer<T> &p) const {
+        (*this)(p, p);
+    }
+
+   private:
+    // 一度に変換する点の個数
+    static constexpr std::size_t BLOCK = 16;
+
+    // 重ならない配列 x, y の m 個の点をその場で変換する
+    void apply(T *x, T *y, std::size_t m) const {
+        for (std::size_t j = 0; j < m; j++) {
+            const T u = x[j], v = y[j];
+#ifdef __FP_FAST_FMA
+            x[j] = internal::mul_add(_a, u, internal::mul_add(_b, v, _c));
+            y[j] = internal::mul_add(_d, u, internal::mul_add(_e, v, _f));
+#else
+            x[j] = _a * u + _b * v + _c;
+            y[j] = _d * u + _e * v + _f;
+#endif
+        }
+    }
+
+    value_type _a, _b, _c, _d, _e, _f;
+};
+
+using AffineTransform = BasicAffineTransform<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_AFFINE_TRANSFORM_HPP_
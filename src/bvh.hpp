@@ -0,0 +1,437 @@
+#ifndef GEOMETRY_BVH_HPP_
+#define GEOMETRY_BVH_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "circle.hpp"
+#include "config.hpp"
+#include "distance.hpp"
+#include "intersection.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+#include "segment.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief a shape stored in BasicBvh.
+ * Circles and polygons are regions including their insides, and
+ * segments are segments.
+ */
+template <class T>
+using BasicShape =
+    std::variant<BasicSegment<T>, BasicCircle<T>, BasicPolygon<T>>;
+
+using Shape = BasicShape<Real>;
+
+namespace internal {
+
+// 軸に平行な外接矩形
+template <class R>
+struct Box {
+    BasicPoint<R> lo, hi;
+
+    bool overlap(const Box &b) const {
+        return le(lo.x(), b.hi.x()) && le(b.lo.x(), hi.x()) &&
+               le(lo.y(), b.hi.y()) && le(b.lo.y(), hi.y());
+    }
+
+    Box merge(const Box &b) const {
+        return {BasicPoint<R>(std::min(lo.x(), b.lo.x()),
+                              std::min(lo.y(), b.lo.y())),
+                BasicPoint<R>(std::max(hi.x(), b.hi.x()),
+                              std::max(hi.y(), b.hi.y()))};
+    }
+
+    // 周長の半分。SAH での費用に用いる
+    R half_perimeter() const {
+        return (hi.x() - lo.x()) + (hi.y() - lo.y());
+    }
+
+    BasicPoint<R> center() const {
+        return (lo + hi) / R(2);
+    }
+};
+
+template <class T, class R = typename coordinate_traits<T>::real_type>
+Box<R> bounding_box(const BasicSegment<T> &s) {
+    BasicPoint<R> a(s.start()), b(s.end());
+    return {BasicPoint<R>(std::min(a.x(), b.x()), std::min(a.y(), b.y())),
+            BasicPoint<R>(std::max(a.x(), b.x()), std::max(a.y(), b.y()))};
+}
+
+template <class T, class R = typename coordinate_traits<T>::real_type>
+Box<R> bounding_box(const BasicCircle<T> &c) {
+    BasicPoint<R> o(c.center()), d(c.radius(), c.radius());
+    return {o - d, o + d};
+}
+
+template <class T, class R = typename coordinate_traits<T>::real_type>
+Box<R> bounding_box(const BasicPolygon<T> &pl) {
+    Box<R> ret{BasicPoint<R>(pl[0]), BasicPoint<R>(pl[0])};
+    for (std::size_t i = 1; i < pl.size(); i++) {
+        BasicPoint<R> p(pl[i]);
+        ret = ret.merge({p, p});
+    }
+    return ret;
+}
+
+template <class T, class R = typename coordinate_traits<T>::real_type>
+Box<R> bounding_box(const BasicShape<T> &s) {
+    return std::visit([](const auto &v) { return bounding_box<T, R>(v); }, s);
+}
+
+// 多角形の辺
+template <class T>
+BasicSegment<T> polygon_edge(const BasicPolygon<T> &pl, std::size_t i) {
+    return BasicSegment<T>(pl[i], pl[(i + 1) % pl.size()]);
+}
+
+// 点 p が多角形の内部か境界上にあるか
+template <class T>
+bool covers(const BasicPolygon<T> &pl, const BasicPoint<T> &p) {
+    return pl.on_object(p) || pl.inside(p);
+}
+
+template <class T>
+bool overlap(const BasicSegment<T> &a, const BasicSegment<T> &b) {
+    return intersection(a, b);
+}
+
+template <class T>
+bool overlap(const BasicCircle<T> &a, const BasicCircle<T> &b) {
+    return intersection(a, b) != IntersectionCC::NOT_CROSS;
+}
+
+template <class T>
+bool overlap(const BasicSegment<T> &s, const BasicCircle<T> &c) {
+    return le(distance(s, c.center()), c.radius());
+}
+
+template <class T>
+bool overlap(const BasicCircle<T> &c, const BasicSegment<T> &s) {
+    return overlap(s, c);
+}
+
+template <class T>
+bool overlap(const BasicSegment<T> &s, const BasicPolygon<T> &pl) {
+    if (covers(pl, s.start())) return true;
+    for (std::size_t i = 0; i < pl.size(); i++) {
+        if (intersection(s, polygon_edge(pl, i))) return true;
+    }
+    return false;
+}
+
+template <class T>
+bool overlap(const BasicPolygon<T> &pl, const BasicSegment<T> &s) {
+    return overlap(s, pl);
+}
+
+template <class T>
+bool overlap(const BasicCircle<T> &c, const BasicPolygon<T> &pl) {
+    if (covers(pl, c.center())) return true;
+    for (std::size_t i = 0; i < pl.size(); i++) {
+        if (overlap(polygon_edge(pl, i), c)) return true;
+    }
+    return false;
+}
+
+template <class T>
+bool overlap(const BasicPolygon<T> &pl, const BasicCircle<T> &c) {
+    return overlap(c, pl);
+}
+
+template <class T>
+bool overlap(const BasicPolygon<T> &a, const BasicPolygon<T> &b) {
+    // 辺が交わらなければ，一方が他方に含まれるときだけ重なる
+    if (covers(a, b[0]) || covers(b, a[0])) return true;
+    for (std::size_t i = 0; i < a.size(); i++) {
+        for (std::size_t j = 0; j < b.size(); j++) {
+            if (intersection(polygon_edge(a, i), polygon_edge(b, j)))
+                return true;
+        }
+    }
+    return false;
+}
+
+template <class T, class Shape>
+bool overlap(const BasicShape<T> &a, const Shape &b) {
+    return std::visit([&b](const auto &v) { return overlap(v, b); }, a);
+}
+
+template <class T>
+bool overlap(const BasicShape<T> &a, const BasicShape<T> &b) {
+    return std::visit(
+        [](const auto &u, const auto &v) { return overlap(u, v); }, a, b);
+}
+
+}  // namespace internal
+
+/**
+ * @brief Bounding volume hierarchy over a static set of shapes.
+ * The tree of axis-aligned bounding boxes is built by the surface area
+ * heuristic with binning, and flattened into an array in depth-first
+ * order: the left child of a node follows it, and the node keeps the
+ * index of the right child.
+ * A query first prunes the shapes by the boxes and then calls
+ * intersection for the remaining candidates.
+ */
+template <class T>
+class BasicBvh {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+    using shape_type = BasicShape<T>;
+    using real_type  = typename coordinate_traits<T>::real_type;
+
+    /**
+     * @brief build the hierarchy in O(n log n) time.
+     * @param shapes Shape
+     */
+    explicit BasicBvh(std::vector<shape_type> shapes)
+        : _shapes(std::move(shapes)) {
+        const size_type n = _shapes.size();
+        _boxes.reserve(n);
+        for (const shape_type &s : _shapes) {
+            _boxes.push_back(internal::bounding_box<T>(s));
+        }
+        _order.resize(n);
+        for (size_type i = 0; i < n; i++) _order[i] = i;
+        if (n > 0) {
+            _nodes.reserve(2 * n);
+            build(0, n);
+        }
+    }
+
+    size_type size() const noexcept {
+        return _shapes.size();
+    }
+
+    const shape_type &operator[](size_type i) const {
+        return _shapes[i];
+    }
+
+    /**
+     * @brief call f(i) for each shape i that intersects the query.
+     * @param q Segment, Circle, Polygon or Shape
+     */
+    template <class Query, class Function>
+    void query(const Query &q, Function &&f) const {
+        if (_nodes.empty()) return;
+        const box_type box = internal::bounding_box<T>(q);
+        // 深さ優先で探索する
+        std::vector<size_type> stack = {0};
+        while (!stack.empty()) {
+            const node_type &node = _nodes[stack.back()];
+            stack.pop_back();
+            if (!node.box.overlap(box)) continue;
+            if (node.count > 0) {
+                for (size_type k = node.first; k < node.first + node.count;
+                     k++) {
+                    size_type i = _order[k];
+                    if (_boxes[i].overlap(box) &&
+                        internal::overlap(_shapes[i], q)) {
+                        f(i);
+                    }
+                }
+            } else {
+                stack.push_back(node.right);
+                stack.push_back(&node - _nodes.data() + 1);
+            }
+        }
+    }
+
+    /**
+     * @brief list the shapes that intersect the query.
+     * @return indices of the shapes in unspecified order.
+     */
+    template <class Query>
+    std::vector<size_type> query(const Query &q) const {
+        std::vector<size_type> ret;
+        query(q, [&ret](size_type i) { ret.push_back(i); });
+        return ret;
+    }
+
+    /**
+     * @brief call f(i, j) with i < j for each pair of intersecting shapes.
+     */
+    template <class Function>
+    void intersecting_pairs(Function &&f) const {
+        if (!_nodes.empty()) self_join(0, 0, f);
+    }
+
+    /**
+     * @brief list the pairs (i, j) with i < j of intersecting shapes.
+     */
+    std::vector<std::pair<size_type, size_type>> intersecting_pairs() const {
+        std::vector<std::pair<size_type, size_type>> ret;
+        intersecting_pairs(
+            [&ret](size_type i, size_type j) { ret.emplace_back(i, j); });
+        return ret;
+    }
+
+   private:
+    using box_type = internal::Box<real_type>;
+
+    struct node_type {
+        box_type box;
+        // 葉なら _order[first, first + count) の図形を持つ
+        size_type first, count;
+        // 内部頂点の右の子
+        size_type right;
+    };
+
+    // 葉に入れる図形の最大数と，SAH で用いる区間の数
+    static constexpr size_type LEAF_SIZE = 4;
+    static constexpr size_type BINS      = 16;
+
+    // _order[first, last) の図形から部分木を作り，根の番号を返す
+    size_type build(size_type first, size_type last) {
+        const size_type id = _nodes.size();
+        _nodes.push_back(node_type());
+        box_type box = _boxes[_order[first]], centers;
+        centers.lo = centers.hi = box.center();
+        for (size_type k = first; k < last; k++) {
+            const box_type &b = _boxes[_order[k]];
+            box               = box.merge(b);
+            centers           = centers.merge({b.center(), b.center()});
+        }
+        _nodes[id].box = box;
+        size_type mid  = split(first, last, centers);
+        if (mid == first) {
+            _nodes[id].first = first;
+            _nodes[id].count = last - first;
+            return id;
+        }
+        build(first, mid);
+        size_type right  = build(mid, last);
+        _nodes[id].count = 0;
+        _nodes[id].right = right;
+        return id;
+    }
+
+    /**
+     * @brief split _order[first, last) by binned SAH.
+     * @return the boundary, or first if it should be a leaf.
+     */
+    size_type split(size_type first, size_type last, const box_type &c) {
+        const size_type n = last - first;
+        if (n <= LEAF_SIZE) return first;
+        // 中心の広がりが大きい方向で分ける
+        const bool      by_x = c.hi.x() - c.lo.x() >= c.hi.y() - c.lo.y();
+        const real_type lo   = by_x ? c.lo.x() : c.lo.y(),
+                        hi   = by_x ? c.hi.x() : c.hi.y();
+        auto bin = [&](size_type i) {
+            BasicPoint<real_type> p = _boxes[i].center();
+            real_type v = ((by_x ? p.x() : p.y()) - lo) / (hi - lo) * BINS;
+            return std::min(size_type(std::max(v, real_type(0))), BINS - 1);
+        };
+        if (!(lo < hi)) {
+            // 中心がすべて一致するときは半分に分ける
+            return first + n / 2;
+        }
+        std::array<size_type, BINS> count{};
+        std::array<box_type, BINS>  boxes;
+        for (size_type k = first; k < last; k++) {
+            size_type b = bin(_order[k]);
+            boxes[b] = count[b]++ ? boxes[b].merge(_boxes[_order[k]])
+                                  : _boxes[_order[k]];
+        }
+        // 区間 [0, s) と [s, BINS) に分けたときの費用を比べる
+        std::array<real_type, BINS> left_cost{};
+        box_type                    acc;
+        size_type                   acc_n = 0;
+        for (size_type s = 1; s < BINS; s++) {
+            if (count[s - 1]) {
+                acc = acc_n ? acc.merge(boxes[s - 1]) : boxes[s - 1];
+                acc_n += count[s - 1];
+            }
+            left_cost[s] = acc_n ? acc.half_perimeter() * acc_n : 0;
+        }
+        size_type best_s = 0;
+        real_type best   = 0;
+        acc_n            = 0;
+        for (size_type s = BINS - 1; s > 0; s--) {
+            if (count[s]) {
+                acc = acc_n ? acc.merge(boxes[s]) : boxes[s];
+                acc_n += count[s];
+            }
+            if (acc_n == 0 || acc_n == n) continue;
+            real_type cost = left_cost[s] + acc.half_perimeter() * acc_n;
+            if (best_s == 0 || cost < best) {
+                best_s = s;
+                best   = cost;
+            }
+        }
+        if (best_s == 0) return first + n / 2;
+        auto it = std::partition(std::begin(_order) + first,
+                                 std::begin(_order) + last,
+                                 [&](size_type i) { return bin(i) < best_s; });
+        return it - std::begin(_order);
+    }
+
+    template <class Function>
+    void self_join(size_type a, size_type b, Function &f) const {
+        const node_type &u = _nodes[a], &v = _nodes[b];
+        if (!u.box.overlap(v.box)) return;
+        if (a == b) {
+            if (u.count > 0) {
+                for (size_type k = u.first; k < u.first + u.count; k++) {
+                    for (size_type l = k + 1; l < u.first + u.count; l++) {
+                        test(_order[k], _order[l], f);
+                    }
+                }
+                return;
+            }
+            self_join(a + 1, a + 1, f);
+            self_join(u.right, u.right, f);
+            self_join(a + 1, u.right, f);
+        } else if (u.count > 0 && v.count > 0) {
+            for (size_type k = u.first; k < u.first + u.count; k++) {
+                for (size_type l = v.first; l < v.first + v.count; l++) {
+                    test(_order[k], _order[l], f);
+                }
+            }
+        } else if (v.count > 0 ||
+                   (u.count == 0 &&
+                    u.box.half_perimeter() >= v.box.half_perimeter())) {
+            // 大きい方の頂点を分ける
+            self_join(a + 1, b, f);
+            self_join(u.right, b, f);
+        } else {
+            self_join(a, b + 1, f);
+            self_join(a, v.right, f);
+        }
+    }
+
+    template <class Function>
+    void test(size_type i, size_type j, Function &f) const {
+        if (_boxes[i].overlap(_boxes[j]) &&
+            internal::overlap(_shapes[i], _shapes[j])) {
+            f(std::min(i, j), std::max(i, j));
+        }
+    }
+
+    std::vector<shape_type> _shapes;
+    // 各図形の外接矩形
+    std::vector<box_type> _boxes;
+    // 葉から参照される図形の番号
+    std::vector<size_type> _order;
+    std::vector<node_type> _nodes;
+};
+
+using Bvh = BasicBvh<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_BVH_HPP_
@@ -1,8 +1,12 @@
 #ifndef GEOMETRY_CIRCLE_HPP_
 #define GEOMETRY_CIRCLE_HPP_
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
 
 #include "config.hpp"
 #include "point.hpp"
@@ -11,54 +15,61 @@ namespace sapphre15 {
 
 namespace geometry {
 
-class Circle {
+template <class T>
+class BasicCircle {
    public:
-    Circle() : _center(), _radius(1.0) {
+    using value_type = T;
+    using real_type  = typename coordinate_traits<T>::real_type;
+    using point_type = BasicPoint<T>;
+
+    BasicCircle() : _center(), _radius(1.0) {
     }
     // 3点 c を中心として半径 r の円
-    Circle(const Point &c, const Real &r) : _center(c), _radius(r) {
+    BasicCircle(const point_type &c, const real_type &r)
+        : _center(c), _radius(r) {
         assert(r >= 0);
     }
     // 3点 c を中心として点 a を通る円
-    Circle(const Point &c, const Point &a) : _center(c), _radius(abs(c - a)) {
+    BasicCircle(const point_type &c, const point_type &a)
+        : _center(c), _radius(abs(c - a)) {
     }
     // 3点 a, b, c を通る円
     // verified with
     // https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/7/CGL_7_C
-    Circle(const Point &a, Point b, Point c) {
+    BasicCircle(const point_type &a, point_type b, point_type c) {
         b -= a;
         c -= a;
-        _center = Point(norm(b) * c.y() - norm(c) * b.y(),
-                        norm(c) * b.x() - norm(b) * c.x()) /
-                  cross(b, c) / 2.0;
+        _center = point_type(norm(b) * c.y() - norm(c) * b.y(),
+                             norm(c) * b.x() - norm(b) * c.x()) /
+                  cross(b, c) / 2;
         _center += a;
         _radius = distance(_center, a);
     }
 
     // 円の中心
-    Point center() const {
+    point_type center() const {
         return _center;
     }
     // 円の半径
-    Real radius() const {
+    real_type radius() const {
         return _radius;
     }
     // 点pは円の内部か(境界を含む)
-    bool inside(const Point &p) const {
+    bool inside(const point_type &p) const {
         return le(distance(_center, p), _radius);
     }
     // 点pは円の外部か
-    bool outside(const Point &p) const {
+    bool outside(const point_type &p) const {
         return !le(distance(_center, p), _radius);
     }
     // 点pは円周上か
-    bool on_object(const Point &p) const {
+    bool on_object(const point_type &p) const {
         return eq(_radius, distance(_center, p));
     }
 
    public:
-    Point _center;
-    Real  _radius;
+    point_type _center;
+    real_type  _radius;
 };
 
 /**
@@ -70,11 +81,82 @@ class Circle {
  * @param c Point
  * @return Circle
  */
-Circle incircle(const Point &a, const Point &b, const Point &c) {
-    Real ab = distance(a, b), bc = distance(b, c), ca = distance(c, a),
-         _s = std::abs(cross(a - c, b - c));
-    return Circle((a * bc + b * ca + c * ab) / (ab + bc + ca),
-                  _s / (ab + bc + ca));
+template <class T>
+BasicCircle<T> incircle(const BasicPoint<T> &a,
+                        const BasicPoint<T> &b,
+                        const BasicPoint<T> &c) {
+    using R = typename coordinate_traits<T>::real_type;
+    R ab = distance(a, b), bc = distance(b, c), ca = distance(c, a),
+      _s = std::abs(R(cross(a - c, b - c)));
+    return BasicCircle<T>((a * bc + b * ca + c * ab) / (ab + bc + ca),
+                          _s / (ab + bc + ca));
+}
+
+/**
+ * @brief return the circle whose diameter is the segment ab.
+ * BasicCircle(c, a) already means the circle with center c through a,
+ * so this is a function rather than a constructor.
+ * @param a Point
+ * @param b Point
+ * @return Circle
+ */
+template <class T>
+BasicCircle<typename coordinate_traits<T>::real_type> diameter_circle(
+    const BasicPoint<T> &a,
+    const BasicPoint<T> &b) {
+    using R = typename coordinate_traits<T>::real_type;
+    BasicPoint<R> c = mid_point(BasicPoint<R>(a), BasicPoint<R>(b));
+    return BasicCircle<R>(c, distance(c, BasicPoint<R>(a)));
+}
+
+namespace internal {
+
+// 3点を通る円。一直線上にあるときは最も遠い2点を直径とする円
+template <class R>
+BasicCircle<R> circle_of_three(const BasicPoint<R> &a,
+                               const BasicPoint<R> &b,
+                               const BasicPoint<R> &c) {
+    if (!colinear(a, b, c)) return BasicCircle<R>(a, b, c);
+    R ab = norm(a - b), bc = norm(b - c), ca = norm(c - a);
+    if (ab >= bc && ab >= ca) return diameter_circle(a, b);
+    return bc >= ca ? diameter_circle(b, c) : diameter_circle(c, a);
+}
+
+}  // namespace internal
+
+/**
+ * @brief find the smallest circle containing all the points.
+ * Welzl's algorithm on the points in random order, which takes O(n)
+ * expected time.
+ * @param points Point. It must not be empty.
+ * @param seed seed of the random order
+ * @return Circle
+ */
+template <class T>
+BasicCircle<typename coordinate_traits<T>::real_type> min_enclosing_circle(
+    const std::vector<BasicPoint<T>> &points,
+    std::uint32_t                     seed = 0) {
+    using R = typename coordinate_traits<T>::real_type;
+    assert(!points.empty());
+    std::vector<BasicPoint<R>> p(std::begin(points), std::end(points));
+    std::shuffle(std::begin(p), std::end(p), std::mt19937(seed));
+    BasicCircle<R> c(p[0], R(0));
+    for (std::size_t i = 1; i < p.size(); i++) {
+        if (c.inside(p[i])) continue;
+        // p[i] は円周上にある
+        c = BasicCircle<R>(p[i], R(0));
+        for (std::size_t j = 0; j < i; j++) {
+            if (c.inside(p[j])) continue;
+            // p[i], p[j] は円周上にある
+            c = diameter_circle(p[i], p[j]);
+            for (std::size_t k = 0; k < j; k++) {
+                if (!c.inside(p[k])) {
+                    c = internal::circle_of_three(p[i], p[j], p[k]);
+                }
+            }
+        }
+    }
+    return c;
 }
 
 }  // namespace geometry
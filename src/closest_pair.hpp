@@ -0,0 +1,137 @@
+#ifndef GEOMETRY_CLOSEST_PAIR_HPP_
+#define GEOMETRY_CLOSEST_PAIR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+// 並列化するときの1スレッドあたりの最小の点数
+constexpr std::size_t CLOSEST_PAIR_MIN_CHUNK = 1 << 13;
+
+// 2点の番号と距離の2乗
+template <class T>
+using closest_pair_type =
+    std::tuple<std::size_t,
+               std::size_t,
+               typename coordinate_traits<T>::product_type>;
+
+template <class T>
+closest_pair_type<T> closest_pair_min(const closest_pair_type<T> &a,
+                                      const closest_pair_type<T> &b) {
+    return std::get<2>(b) < std::get<2>(a) ? b : a;
+}
+
+/**
+ * @brief divide and conquer on the points sorted by x-coordinate.
+ * After the call, [first, last) is sorted by y-coordinate.
+ * @param best a pair found so far, which bounds the search
+ * @param threads number of threads for this range
+ */
+template <class T>
+closest_pair_type<T> closest_pair_rec(
+    std::pair<BasicPoint<T>, std::size_t> *first,
+    std::pair<BasicPoint<T>, std::size_t> *last,
+    closest_pair_type<T>                   best,
+    std::size_t                            threads) {
+    using product_type = typename coordinate_traits<T>::product_type;
+    using element      = std::pair<BasicPoint<T>, std::size_t>;
+    auto y_less = [](const element &a, const element &b) {
+        return a.first.y() < b.first.y();
+    };
+    auto update = [&best](const element &a, const element &b) {
+        product_type d = norm(a.first - b.first);
+        if (d < std::get<2>(best)) {
+            best = closest_pair_type<T>(std::min(a.second, b.second),
+                                        std::max(a.second, b.second),
+                                        d);
+        }
+    };
+    const std::size_t n = last - first;
+    if (n <= 3) {
+        for (auto a = first; a != last; ++a) {
+            for (auto b = a + 1; b != last; ++b) update(*a, *b);
+        }
+        std::sort(first, last, y_less);
+        return best;
+    }
+    element *mid = first + n / 2;
+    const T  x   = mid->first.x();
+    if (threads > 1 && n >= 2 * CLOSEST_PAIR_MIN_CHUNK) {
+        const closest_pair_type<T> init = best;
+        closest_pair_type<T>       left = best;
+        std::thread                worker([&] {
+            left = closest_pair_rec<T>(first, mid, init, threads / 2);
+        });
+        best = closest_pair_rec<T>(mid, last, init, threads - threads / 2);
+        worker.join();
+        best = closest_pair_min<T>(best, left);
+    } else {
+        best = closest_pair_rec<T>(first, mid, best, 1);
+        best = closest_pair_rec<T>(mid, last, best, 1);
+    }
+    std::inplace_merge(first, mid, last, y_less);
+    // 分割線から距離 d 未満の点を y 座標の順に見る
+    std::vector<element> strip;
+    for (element *a = first; a != last; ++a) {
+        product_type dx = product_type(a->first.x()) - product_type(x);
+        if (!(dx * dx < std::get<2>(best))) continue;
+        for (auto b = strip.rbegin(); b != strip.rend(); ++b) {
+            product_type dy =
+                product_type(a->first.y()) - product_type(b->first.y());
+            if (!(dy * dy < std::get<2>(best))) break;
+            update(*a, *b);
+        }
+        strip.push_back(*a);
+    }
+    return best;
+}
+
+}  // namespace internal
+
+/**
+ * @brief find the closest pair of the points in O(n log n) time.
+ * verified with
+ * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/5/CGL_5_A
+ * Distances are compared by norm, so no square root is calculated, and
+ * the result is exact for integer coordinates.
+ * @param points Point. It must have at least 2 points.
+ * @param threads number of threads. If it is more than 1, the two halves
+ * of large ranges are processed in parallel.
+ * @return std::tuple (i, j, d) with i < j, where d is the squared
+ * distance between points[i] and points[j].
+ */
+template <class T>
+internal::closest_pair_type<T> closest_pair(
+    const std::vector<BasicPoint<T>> &points,
+    std::size_t                       threads = 1) {
+    const std::size_t n = points.size();
+    assert(2 <= n);
+    std::vector<std::pair<BasicPoint<T>, std::size_t>> p(n);
+    for (std::size_t i = 0; i < n; i++) p[i] = {points[i], i};
+    std::sort(std::begin(p), std::end(p), [](const auto &a, const auto &b) {
+        return a.first.x() < b.first.x();
+    });
+    internal::closest_pair_type<T> best(0, 1, norm(points[0] - points[1]));
+    return internal::closest_pair_rec<T>(
+        p.data(), p.data() + n, best, std::max<std::size_t>(threads, 1));
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_CLOSEST_PAIR_HPP_
@@ -2,6 +2,8 @@
 #define GEOMETRY_CONFIG_HPP_
 
 #include <cmath>
+#include <cstdint>
+#include <type_traits>
 
 namespace sapphre15 {
 
@@ -10,37 +12,158 @@ namespace geometry {
 // 座標を扱う型
 using Real = double;
 
+namespace internal {
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 int128_t;
+#endif
+
+// 組み込みの整数型に __int128 を加えたもの
+template <class T>
+struct is_integer : std::is_integral<T> {};
+#ifdef __SIZEOF_INT128__
+template <>
+struct is_integer<int128_t> : std::true_type {};
+#endif
+
+// 2つの T の積を溢れずに表せる整数型
+template <class T>
+struct wide_integer {
+#ifdef __SIZEOF_INT128__
+    using type = std::conditional_t<(sizeof(T) <= 4), std::int64_t, int128_t>;
+#else
+    using type = std::int64_t;
+#endif
+};
+
+}  // namespace internal
+
+/**
+ * @brief 座標の型 T ごとの誤差定数と比較関数
+ * 浮動小数点数は誤差 eps を許して比較し，整数は厳密に比較する。
+ * real_type は距離や角度など，座標から計算される実数値の型。
+ * product_type は内積や外積など，座標の積の型。
+ */
+template <class T, class = void>
+struct coordinate_traits {};
+
+template <class T>
+struct coordinate_traits<T,
+                         std::enable_if_t<std::is_floating_point<T>::value>> {
+    using value_type   = T;
+    using real_type    = T;
+    using product_type = T;
+
+    static constexpr bool is_exact = false;
+    // 比較に用いる誤差定数
+    static constexpr T eps = std::is_same<T, float>::value ? T(1e-5)
+                                                           : T(1e-10);
+
+    // 符号関数
+    static constexpr int sgn(T a) {
+        return (a < -eps) ? -1 : (a > eps) ? 1 : 0;
+    }
+    // 値の比較
+    static bool eq(T a, T b) {
+        if (std::abs(a) > T(1.0))
+            return std::abs((a - b) / a) < eps;
+        else
+            return std::abs(a - b) < eps;
+    }
+    // a <= b
+    static bool le(T a, T b) {
+        return a < b || eq(a, b);
+    }
+};
+
+/**
+ * 整数座標では積を product_type で計算するので，ccw や面積に誤差は出ない。
+ * int32_t は |座標| < 2^30, int64_t は |座標| < 2^62 の範囲で厳密。
+ * in_circle などの座標の4次式は __int128 で計算し，どちらの型でも
+ * |座標| < 2^30 の範囲で厳密になる。int64_t ではこの範囲を assert で確かめる。
+ */
+template <class T>
+struct coordinate_traits<T,
+                         std::enable_if_t<internal::is_integer<T>::value>> {
+    using value_type   = T;
+    using real_type    = Real;
+    using product_type = typename internal::wide_integer<T>::type;
+
+    static constexpr bool is_exact = true;
+    static constexpr T    eps      = 0;
+
+    static constexpr int sgn(T a) {
+        return (a < 0) ? -1 : (a > 0) ? 1 : 0;
+    }
+    static constexpr bool eq(T a, T b) {
+        return a == b;
+    }
+    static constexpr bool le(T a, T b) {
+        return a <= b;
+    }
+};
+
 // 比較に用いる誤差定数
-constexpr Real EPS = 1e-10;
+constexpr Real EPS = coordinate_traits<Real>::eps;
 // 円周率
 const Real PI = std::acos(Real(-1.0));
 
 // 符号関数
 constexpr int sgn(Real a) {
-    return (a < -EPS) ? -1 : (a > EPS) ? 1 : 0;
+    return coordinate_traits<Real>::sgn(a);
 }
 // 値の比較
 bool eq(Real a, Real b) {
-    if (std::abs(a) > 1.0)
-        return std::abs((a - b) / a) < EPS;
-    else
-        return std::abs(a - b) < EPS;
+    return coordinate_traits<Real>::eq(a, b);
 }
 
 // a <= b
 bool le(Real a, Real b) {
-    return a < b || eq(a, b);
+    return coordinate_traits<Real>::le(a, b);
+}
+
+// Real 以外の座標型での符号関数と比較
+template <class T>
+constexpr auto sgn(T a) -> decltype(coordinate_traits<T>::sgn(a)) {
+    return coordinate_traits<T>::sgn(a);
+}
+
+template <class T>
+auto eq(T a, T b) -> decltype(coordinate_traits<T>::eq(a, b)) {
+    return coordinate_traits<T>::eq(a, b);
 }
 
-class Point;
+template <class T>
+auto le(T a, T b) -> decltype(coordinate_traits<T>::le(a, b)) {
+    return coordinate_traits<T>::le(a, b);
+}
+
+template <class T>
+class BasicPoint;
+namespace internal {
+template <class T>
+class BasicLineBase;
+}  // namespace internal
+template <class T>
+class BasicLine;
+template <class T>
+class BasicRay;
+template <class T>
+class BasicSegment;
+template <class T>
+class BasicCircle;
+template <class T>
+class BasicPolygon;
+
+using Point = BasicPoint<Real>;
 namespace internal {
-class LineBase;
+using LineBase = BasicLineBase<Real>;
 }  // namespace internal
-class Line;
-class Ray;
-class Segment;
-class Circle;
-class Polygon;
+using Line    = BasicLine<Real>;
+using Ray     = BasicRay<Real>;
+using Segment = BasicSegment<Real>;
+using Circle  = BasicCircle<Real>;
+using Polygon = BasicPolygon<Real>;
 
 }  // namespace geometry
 
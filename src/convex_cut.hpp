@@ -0,0 +1,105 @@
+#ifndef GEOMETRY_CONVEX_CUT_HPP_
+#define GEOMETRY_CONVEX_CUT_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "config.hpp"
+#include "line.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+// 直線の左側なら 1, 右側なら -1, 直線上なら 0
+template <class Predicate, class T>
+int line_side(const BasicPoint<T> &a,
+              const BasicPoint<T> &b,
+              const BasicPoint<T> &p) {
+    ClockWise c = ccw<Predicate>(a, b, p);
+    return c == COUNTER_CLOCKWISE ? 1 : c == CLOCKWISE ? -1 : 0;
+}
+
+// at(0), ..., at(n - 1) を頂点とする凸多角形を切って out に書き出す
+template <class Predicate, class T, class Access>
+void convex_cut(std::size_t                 n,
+                Access                      at,
+                const BasicLine<T>         &l,
+                std::vector<BasicPoint<T>> &out) {
+    using R     = typename coordinate_traits<T>::real_type;
+    auto [a, b] = l.points();
+    out.clear();
+    if (n == 0) return;
+    int side = line_side<Predicate>(a, b, at(n - 1));
+    for (std::size_t i = 0; i < n; i++) {
+        const BasicPoint<T> &p = at(i == 0 ? n - 1 : i - 1), &q = at(i);
+        int                  next = line_side<Predicate>(a, b, q);
+        // 辺 pq が直線をまたぐときは交点を加える
+        if (side * next < 0) {
+            R cp = R(cross(b - a, p - a)), cq = R(cross(b - a, q - a));
+            out.push_back(round_point<T>(
+                BasicPoint<R>(p) + BasicPoint<R>(q - p) * (cp / (cp - cq))));
+        }
+        if (next >= 0) out.push_back(q);
+        side = next;
+    }
+}
+
+}  // namespace internal
+
+/**
+ * @brief cut the convex polygon by the line and keep the left side,
+ * writing the vertexes into a buffer.
+ * out is cleared and reused, so cutting a region by many lines with two
+ * buffers in turn does not allocate memory once the buffers are large
+ * enough. For integer coordinates, the cut points are rounded to the
+ * nearest integers.
+ * @param points vertexes of a convex polygon in counterclockwise order
+ * @param l Line. The left side of the direction is kept.
+ * @param out vertexes of the left side in counterclockwise order. It has
+ * less than 3 points if the left side is empty, a point or a segment.
+ */
+template <class Predicate = EpsilonPredicate, class T>
+void convex_cut(const std::vector<BasicPoint<T>> &points,
+                const BasicLine<T>               &l,
+                std::vector<BasicPoint<T>>       &out) {
+    internal::convex_cut<Predicate>(
+        points.size(),
+        [&points](std::size_t i) -> const BasicPoint<T> & { return points[i]; },
+        l,
+        out);
+}
+
+/**
+ * @brief cut the convex polygon by the line and return the left side.
+ * verified with
+ * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/4/CGL_4_C
+ * @param pl Polygon. It must be convex.
+ * @param l Line. The left side of the direction is kept.
+ * @return std::nullopt if the left side has no area.
+ */
+template <class Predicate = EpsilonPredicate, class T>
+std::optional<BasicPolygon<T>> convex_cut(const BasicPolygon<T> &pl,
+                                          const BasicLine<T>    &l) {
+    std::vector<BasicPoint<T>> out;
+    internal::convex_cut<Predicate>(
+        pl.size(),
+        [&pl](std::size_t i) -> const BasicPoint<T> & { return pl[i]; },
+        l,
+        out);
+    if (out.size() < 3) return std::nullopt;
+    BasicPolygon<T> ret(out);
+    if (sgn(ret.area2()) == 0) return std::nullopt;
+    return ret;
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_CONVEX_CUT_HPP_
@@ -0,0 +1,145 @@
+#ifndef GEOMETRY_CONVEX_HULL_HPP_
+#define GEOMETRY_CONVEX_HULL_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+// 並列化するときの1スレッドあたりの最小の点数
+constexpr std::size_t HULL_MIN_CHUNK = 1 << 12;
+
+// (y, x) の辞書順
+template <class T>
+bool hull_less(const BasicPoint<T> &a, const BasicPoint<T> &b) {
+    return a.y() != b.y() ? a.y() < b.y() : a.x() < b.x();
+}
+
+/**
+ * @brief Andrew's monotone chain.
+ * @param p points sorted by hull_less without duplicates
+ * @param keep_colinear keep the points on the edges of the hull
+ * @return vertexes of the hull in counter-clockwise order
+ */
+template <class Predicate, class T>
+std::vector<BasicPoint<T>> monotone_chain(const std::vector<BasicPoint<T>> &p,
+                                          bool keep_colinear) {
+    const std::size_t n = p.size();
+    if (n <= 2) return p;
+    // 最後の2点と p から成る角で，最後の点を取り除くべきか
+    auto pop = [keep_colinear](ClockWise c) {
+        return keep_colinear ? c == CLOCKWISE : c != COUNTER_CLOCKWISE;
+    };
+    std::vector<BasicPoint<T>> h(2 * n);
+    std::size_t                k = 0;
+    for (std::size_t i = 0; i < n; i++) {
+        while (k >= 2 && pop(ccw<Predicate>(h[k - 2], h[k - 1], p[i]))) k--;
+        h[k++] = p[i];
+    }
+    // 全点が一直線上にあるときは，折り返すと同じ点を2度通ってしまう
+    if (keep_colinear && k == n &&
+        std::all_of(std::begin(p), std::end(p), [&](const BasicPoint<T> &q) {
+            return colinear<Predicate>(p[0], p[n - 1], q);
+        })) {
+        return p;
+    }
+    for (std::size_t i = n - 1, t = k + 1; i-- > 0;) {
+        while (k >= t && pop(ccw<Predicate>(h[k - 2], h[k - 1], p[i]))) k--;
+        h[k++] = p[i];
+    }
+    h.resize(k - 1);
+    return h;
+}
+
+template <class Predicate, class T>
+std::vector<BasicPoint<T>> convex_hull_sequential(
+    std::vector<BasicPoint<T>> points,
+    bool                       keep_colinear) {
+    std::sort(std::begin(points), std::end(points), hull_less<T>);
+    points.erase(std::unique(std::begin(points), std::end(points)),
+                 std::end(points));
+    return monotone_chain<Predicate>(points, keep_colinear);
+}
+
+}  // namespace internal
+
+/**
+ * @brief calculate the convex hull of the points.
+ * verified with
+ * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/4/CGL_4_A
+ * @param points Point
+ * @param keep_colinear if true, the points on the edges of the hull are
+ * also returned.
+ * @param threads number of threads. If it is more than 1, the points are
+ * split into chunks whose hulls are calculated in parallel, and then the
+ * hull of those hulls is calculated.
+ * @return std::vector<Point>
+ * The vertexes are in counter-clockwise order starting from the point
+ * with the minimum y-coordinate (the minimum x-coordinate among ties).
+ * If all the points are colinear, it has at most 2 points unless
+ * keep_colinear is true.
+ */
+template <class Predicate = EpsilonPredicate, class T>
+std::vector<BasicPoint<T>> convex_hull_points(
+    std::vector<BasicPoint<T>> points,
+    bool                       keep_colinear = false,
+    std::size_t                threads       = 1) {
+    const std::size_t n = points.size();
+    threads = std::min(threads, n / internal::HULL_MIN_CHUNK);
+    if (threads <= 1) {
+        return internal::convex_hull_sequential<Predicate>(std::move(points),
+                                                           keep_colinear);
+    }
+    // 各部分の凸包の頂点だけを残しても，全体の凸包は変わらない
+    const std::size_t                       chunk = (n + threads - 1) / threads;
+    std::vector<std::vector<BasicPoint<T>>> partial(threads);
+    std::vector<std::thread>                workers;
+    workers.reserve(threads);
+    for (std::size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            auto first = std::begin(points) + std::min(n, t * chunk),
+                 last  = std::begin(points) + std::min(n, (t + 1) * chunk);
+            partial[t] = internal::convex_hull_sequential<Predicate>(
+                std::vector<BasicPoint<T>>(first, last), keep_colinear);
+        });
+    }
+    for (std::thread &worker : workers) worker.join();
+    std::vector<BasicPoint<T>> merged;
+    for (const auto &hull : partial) {
+        merged.insert(std::end(merged), std::begin(hull), std::end(hull));
+    }
+    return internal::convex_hull_sequential<Predicate>(std::move(merged),
+                                                       keep_colinear);
+}
+
+/**
+ * @brief calculate the convex hull of the points as a polygon.
+ * The hull must have at least 3 vertexes.
+ * See convex_hull_points for the parameters.
+ * @return Polygon
+ */
+template <class Predicate = EpsilonPredicate, class T>
+BasicPolygon<T> convex_hull(const std::vector<BasicPoint<T>> &points,
+                            bool        keep_colinear = false,
+                            std::size_t threads       = 1) {
+    return BasicPolygon<T>(
+        convex_hull_points<Predicate>(points, keep_colinear, threads));
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_CONVEX_HULL_HPP_
@@ -0,0 +1,159 @@
+#ifndef GEOMETRY_CONVEX_POLYGON_LOCATOR_HPP_
+#define GEOMETRY_CONVEX_POLYGON_LOCATOR_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "point_buffer.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief Locate points in a convex polygon in O(log n) per query.
+ * The polygon is preprocessed into a fan of triangles from its first
+ * vertex, and a query binary-searches the triangle that contains it.
+ * Vertexes where the boundary goes straight are removed beforehand,
+ * which does not change the region.
+ */
+template <class T, class Predicate = EpsilonPredicate>
+class BasicConvexPolygonLocator {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+    using point_type = BasicPoint<T>;
+
+    /**
+     * @brief preprocess the convex polygon.
+     * @param pl Polygon. It must be convex.
+     */
+    explicit BasicConvexPolygonLocator(const BasicPolygon<T> &pl) {
+        const size_type n = pl.size();
+        _v.reserve(n);
+        for (size_type i = 0; i < n; i++) {
+            const point_type &prev = pl[(i + n - 1) % n],
+                             &next = pl[(i + 1) % n];
+            ClockWise turn = ccw<Predicate>(prev, pl[i], next);
+            assert(turn != CLOCKWISE);
+            if (turn == COUNTER_CLOCKWISE) _v.push_back(pl[i]);
+        }
+        assert(3 <= _v.size());
+    }
+
+    /**
+     * @brief number of the vertexes after preprocessing.
+     */
+    size_type size() const noexcept {
+        return _v.size();
+    }
+
+    /**
+     * @brief locate the point.
+     * @param p Point
+     * @return PointLocation
+     */
+    PointLocation locate(const point_type &p) const {
+        const size_type   n  = _v.size();
+        const point_type &v0 = _v[0];
+        // 最初の辺と最後の辺で作られる角の外側にあるか
+        ClockWise first = ccw<Predicate>(v0, _v[1], p);
+        if (first == CLOCKWISE) return PointLocation::OUTSIDE;
+        if (first != COUNTER_CLOCKWISE) return on_edge(first);
+        ClockWise last = ccw<Predicate>(v0, _v[n - 1], p);
+        if (last == COUNTER_CLOCKWISE) return PointLocation::OUTSIDE;
+        if (last != CLOCKWISE) return on_edge(last);
+        // p を含む三角形 v0, v[lo], v[lo + 1] を二分探索する
+        size_type lo = 1, hi = n - 1;
+        while (hi - lo > 1) {
+            size_type mid = (lo + hi) / 2;
+            if (ccw<Predicate>(v0, _v[mid], p) == CLOCKWISE)
+                hi = mid;
+            else
+                lo = mid;
+        }
+        switch (ccw<Predicate>(_v[lo], _v[lo + 1], p)) {
+            case COUNTER_CLOCKWISE:
+                return PointLocation::INSIDE;
+            case ON_SEGMENT:
+                return PointLocation::ON_BOUNDARY;
+            default:
+                return PointLocation::OUTSIDE;
+        }
+    }
+
+    /**
+     * @brief locate the n points starting from points into out.
+     */
+    void locate(const point_type *points,
+                size_type         n,
+                PointLocation    *out) const {
+        for (size_type i = 0; i < n; i++) out[i] = locate(points[i]);
+    }
+
+    /**
+     * @brief locate each point of the buffer into out.
+     */
+    void locate(const BasicPointBuffer<T> &buf, PointLocation *out) const {
+        const T *x = buf.x_data(), *y = buf.y_data();
+        for (size_type i = 0; i < buf.size(); i++) {
+            out[i] = locate(point_type(x[i], y[i]));
+        }
+    }
+
+    std::vector<PointLocation> locate(
+        const std::vector<point_type> &points) const {
+        std::vector<PointLocation> ret(points.size());
+        locate(points.data(), points.size(), ret.data());
+        return ret;
+    }
+
+    std::vector<PointLocation> locate(const BasicPointBuffer<T> &buf) const {
+        std::vector<PointLocation> ret(buf.size());
+        locate(buf, ret.data());
+        return ret;
+    }
+
+    /**
+     * @brief Check if the point is strictly inside the polygon.
+     */
+    bool inside(const point_type &p) const {
+        return locate(p) == PointLocation::INSIDE;
+    }
+
+    /**
+     * @brief Check if the point is on edges of the polygon.
+     */
+    bool on_object(const point_type &p) const {
+        return locate(p) == PointLocation::ON_BOUNDARY;
+    }
+
+    /**
+     * @brief Check if the point is strictly outside the polygon.
+     */
+    bool outside(const point_type &p) const {
+        return locate(p) == PointLocation::OUTSIDE;
+    }
+
+   private:
+    // 最初の辺か最後の辺を含む直線上にある点の位置
+    static PointLocation on_edge(ClockWise c) {
+        return c == ON_SEGMENT ? PointLocation::ON_BOUNDARY
+                               : PointLocation::OUTSIDE;
+    }
+
+    // 反時計回りに並んだ頂点
+    std::vector<point_type> _v;
+};
+
+using ConvexPolygonLocator = BasicConvexPolygonLocator<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_CONVEX_POLYGON_LOCATOR_HPP_
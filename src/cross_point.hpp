@@ -5,10 +5,10 @@
 #include <cassert>
 #include <type_traits>
 #include <utility>
-#include <vector>
 
 #include "circle.hpp"
 #include "config.hpp"
+#include "fixed_vector.hpp"
 #include "intersection.hpp"
 #include "line.hpp"
 #include "point.hpp"
@@ -18,28 +18,37 @@ namespace sapphre15 {
 
 namespace geometry {
 
-std::vector<Point> cross_point(const Line &a, const Line &b) {
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicLine<T> &a,
+                                          const BasicLine<T> &b) {
     assert(!parallel(a, b));
-    Point da = a._b - a._a, db = b._b - b._a;
+    BasicPoint<T> da = a._b - a._a, db = b._b - b._a;
     return {a._a - da / cross(da, db) * cross(a._a - b._a, db)};
 }
 
-std::vector<Point> cross_point(const Segment &a, const Line &b) {
-    std::vector<Point> ret = cross_point((Line)a, b);
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicSegment<T> &a,
+                                          const BasicLine<T>    &b) {
+    FixedVector<BasicPoint<T>, 2> ret = cross_point(BasicLine<T>(a), b);
     if (a.on_object(ret[0]))
         return ret;
     else
         return {};
 }
 
-std::vector<Point> cross_point(const Line &a, const Segment &b) {
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicLine<T>    &a,
+                                          const BasicSegment<T> &b) {
     return cross_point(b, a);
 }
 
 // verified with
 // https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/2/CGL_2_C
-std::vector<Point> cross_point(const Segment &a, const Segment &b) {
-    std::vector<Point> ret = cross_point((Line)a, (Line)b);
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicSegment<T> &a,
+                                          const BasicSegment<T> &b) {
+    FixedVector<BasicPoint<T>, 2> ret =
+        cross_point(BasicLine<T>(a), BasicLine<T>(b));
     if (a.on_object(ret[0]) && b.on_object(ret[0]))
         return ret;
     else
@@ -52,14 +61,16 @@ std::vector<Point> cross_point(const Segment &a, const Segment &b) {
  * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/7/CGL_7_D
  * @param c Circle
  * @param l Point
- * @return std::vector<Point>
- * If there are no cross points, returned vector is empty.
+ * @return FixedVector<Point, 2>
+ * If there are no cross points, it is empty.
  * If the line touches the circle, it has one element.
  * Otherwise, it has two cross point.
  */
-std::vector<Point> cross_point(const Circle &c, const Line &l) {
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicCircle<T> &c,
+                                          const BasicLine<T>   &l) {
     auto d1 = distance(c.center(), l);
-    auto v1 = l.direction() * sqrt(c.radius() * c.radius() - d1 * d1),
+    auto v1 = l.direction() * std::sqrt(c.radius() * c.radius() - d1 * d1),
          p1 = projection(l, c.center());
     switch (intersection(c, l)) {
         case IntersectionCL::CROSS:
@@ -81,12 +92,14 @@ std::vector<Point> cross_point(const Circle &c, const Line &l) {
  * @brief calculate cross points of the point and the circle.
  * @param l Point
  * @param c Circle
- * @return std::vector<Point>
- * If there are no cross points, returned vector is empty.
+ * @return FixedVector<Point, 2>
+ * If there are no cross points, it is empty.
  * If the line touches the circle, it has one element.
  * Otherwise, it has two cross point.
  */
-std::vector<Point> cross_point(const Line &l, const Circle &c) {
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicLine<T>   &l,
+                                          const BasicCircle<T> &c) {
     return cross_point(c, l);
 }
 
@@ -94,9 +107,11 @@ std::vector<Point> cross_point(const Line &l, const Circle &c) {
  * @brief calculate corss point of the two circles.
  * @param c1 Circle
  * @param c2 Circle
- * @return std::vector<Point>
+ * @return FixedVector<Point, 2>
  */
-std::vector<Point> cross_point(const Circle &c1, const Circle &c2) {
+template <class T>
+FixedVector<BasicPoint<T>, 2> cross_point(const BasicCircle<T> &c1,
+                                          const BasicCircle<T> &c2) {
     /**
      * To calculate cross points, we consider the line
      * To calculate the intersection, consider a line
@@ -116,19 +131,23 @@ std::vector<Point> cross_point(const Circle &c1, const Circle &c2) {
      * Here, k = (r2^2 - r1^2) / (a^2 + b^2) / 2.
      */
     // midpoint of the center
-    Point _m = (c1.center() + c2.center()) / 2,
-          // a = _d.x(), _b = d.y()
-        _d      = (c1.center() - c2.center());
-    Real r_diff = fma(c2.radius(), c2.radius(), -c1.radius() * c1.radius()) / 2,
-         _k = r_diff / norm(_d), _s = (_d.x() + _d.y()), _t = (_d.x() - _d.y());
-    if (eq(r_diff, 0.0)) {
+    using internal::mul_add;
+    using P = BasicPoint<T>;
+    using R = typename coordinate_traits<T>::real_type;
+    P _m = (c1.center() + c2.center()) / 2,
+      // a = _d.x(), _b = d.y()
+        _d = (c1.center() - c2.center());
+    R r_diff =
+          mul_add(c2.radius(), c2.radius(), -c1.radius() * c1.radius()) / 2,
+      _k = r_diff / norm(_d), _s = (_d.x() + _d.y()), _t = (_d.x() - _d.y());
+    if (eq(r_diff, R(0))) {
         // if vertical bisector is implemented, we will replace.
-        return cross_point(c1, Line(_m, _m + rotate(_d, PI / 2)));
+        return cross_point(c1, BasicLine<T>(_m, _m + rotate(_d, PI / 2)));
     } else {
         return cross_point(
             c1,
-            Line(Point(fma(_s, _k, _m.x()), fma(-_t, _k, _m.y())),
-                 Point(fma(_t, _k, _m.x()), fma(_s, _k, _m.y()))));
+            BasicLine<T>(P(mul_add(_s, _k, _m.x()), mul_add(-_t, _k, _m.y())),
+                         P(mul_add(_t, _k, _m.x()), mul_add(_s, _k, _m.y()))));
     }
 }
 
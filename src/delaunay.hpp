@@ -0,0 +1,563 @@
+#ifndef GEOMETRY_DELAUNAY_HPP_
+#define GEOMETRY_DELAUNAY_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "robust_predicate.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+// この個数以下のラウンドは分けずに並べる
+constexpr std::size_t BRIO_MIN_ROUND = 64;
+
+// 2^16 x 2^16 の格子上の Hilbert 曲線に沿った位置
+inline std::uint64_t hilbert_index(std::uint32_t x, std::uint32_t y) {
+    std::uint64_t d = 0;
+    for (std::uint32_t s = 1u << 15; s > 0; s >>= 1) {
+        std::uint32_t rx = (x & s) ? 1 : 0, ry = (y & s) ? 1 : 0;
+        d += std::uint64_t(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = s - 1 - x;
+                y = s - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+/**
+ * @brief biased randomized insertion order (BRIO).
+ * The points are shuffled, and the shuffled sequence is split into
+ * rounds whose sizes double from the front to the back. Each round is
+ * sorted along a Hilbert curve, so consecutive points are close to each
+ * other while the order of the rounds stays random.
+ */
+template <class T>
+std::vector<std::size_t> brio_order(const std::vector<BasicPoint<T>> &points,
+                                    std::uint32_t                     seed) {
+    using real_type     = typename coordinate_traits<T>::real_type;
+    const std::size_t n = points.size();
+    std::vector<std::size_t> order(n);
+    std::iota(std::begin(order), std::end(order), 0);
+    std::shuffle(std::begin(order), std::end(order), std::mt19937(seed));
+    if (n == 0) return order;
+    real_type min_x = points[0].x(), max_x = min_x;
+    real_type min_y = points[0].y(), max_y = min_y;
+    for (const BasicPoint<T> &p : points) {
+        min_x = std::min<real_type>(min_x, p.x());
+        max_x = std::max<real_type>(max_x, p.x());
+        min_y = std::min<real_type>(min_y, p.y());
+        max_y = std::max<real_type>(max_y, p.y());
+    }
+    const real_type span = std::max(max_x - min_x, max_y - min_y);
+    const real_type unit = span > 0 ? real_type(65535) / span : real_type(0);
+    std::vector<std::uint64_t> key(n);
+    for (std::size_t i = 0; i < n; i++) {
+        key[i] = hilbert_index(
+            std::uint32_t((real_type(points[i].x()) - min_x) * unit),
+            std::uint32_t((real_type(points[i].y()) - min_y) * unit));
+    }
+    for (std::size_t last = n; last > 0;) {
+        std::size_t first = last <= BRIO_MIN_ROUND ? 0 : last / 2;
+        std::sort(std::begin(order) + first,
+                  std::begin(order) + last,
+                  [&key](std::size_t a, std::size_t b) {
+                      return key[a] < key[b];
+                  });
+        last = first;
+    }
+    return order;
+}
+
+/**
+ * @brief Bowyer-Watson insertion with ghost triangles.
+ * Each hull edge (u, v) has a ghost triangle (v, u, INF) outside it, so
+ * every point outside the hull is in some triangle and no bounding
+ * triangle is needed. The circumcircle of a ghost triangle is the open
+ * half-plane outside its edge together with the open edge.
+ * The triangle t has the half-edges 3t, 3t + 1 and 3t + 2, and the
+ * half-edge e goes from _v[e] to _v[next(e)].
+ */
+template <class T, class Predicate>
+class DelaunayBuilder {
+   public:
+    using size_type  = std::size_t;
+    using point_type = BasicPoint<T>;
+    // 空洞を作り直すときの判定。double に誤差なく変換できる座標では厳密
+    using Strict = std::conditional_t<(sizeof(T) <= sizeof(Real)),
+                                      ExactPredicate,
+                                      Predicate>;
+
+    static constexpr size_type NONE = size_type(-1);
+
+    static size_type next(size_type e) {
+        return e % 3 == 2 ? e - 2 : e + 1;
+    }
+
+    DelaunayBuilder(const std::vector<point_type> &points, std::uint32_t seed)
+        : _p(points),
+          _inf(points.size()),
+          _vmark(points.size() + 1, 0),
+          _start(points.size() + 1) {
+        std::vector<size_type> order = brio_order(_p, seed);
+        if (!init(order)) return;
+        for (size_type i : order) {
+            if (i != _v[0] && i != _v[1] && i != _v[2]) insert(i);
+        }
+    }
+
+    // ゴーストを除いた三角形と，その隣接関係を書き出す
+    void extract(std::vector<size_type> &triangles,
+                 std::vector<size_type> &halfedges) const {
+        const size_type        m = _v.size() / 3;
+        std::vector<size_type> id(m, NONE);
+        size_type              cnt = 0;
+        for (size_type t = 0; t < m; t++) {
+            if (!is_ghost(t)) id[t] = cnt++;
+        }
+        triangles.resize(3 * cnt);
+        halfedges.resize(3 * cnt);
+        for (size_type t = 0; t < m; t++) {
+            if (id[t] == NONE) continue;
+            for (size_type i = 0; i < 3; i++) {
+                size_type e = 3 * t + i, f = _h[e];
+                triangles[3 * id[t] + i] = _v[e];
+                halfedges[3 * id[t] + i] =
+                    id[f / 3] == NONE ? NONE : 3 * id[f / 3] + f % 3;
+            }
+        }
+    }
+
+   private:
+    bool is_ghost(size_type t) const {
+        return _v[3 * t] == _inf || _v[3 * t + 1] == _inf ||
+               _v[3 * t + 2] == _inf;
+    }
+
+    // ゴーストの三角形の INF を含まない辺
+    size_type real_edge(size_type t) const {
+        for (size_type i = 0; i < 3; i++) {
+            if (_v[3 * t + i] == _inf) return 3 * t + (i + 1) % 3;
+        }
+        return NONE;
+    }
+
+    void link(size_type e, size_type f) {
+        _h[e] = f;
+        _h[f] = e;
+    }
+
+    void add_triangle(size_type a, size_type b, size_type c) {
+        _v.insert(std::end(_v), {a, b, c});
+        _h.insert(std::end(_h), 3, NONE);
+        _mark.push_back(0);
+    }
+
+    // 一直線上にない3点で最初の三角形を作る
+    bool init(const std::vector<size_type> &order) {
+        if (order.empty()) return false;
+        const size_type a = order[0];
+        size_type       b = NONE, c = NONE;
+        for (size_type i : order) {
+            if (b == NONE) {
+                if (!Predicate::equal(_p[i], _p[a])) b = i;
+            } else if (!colinear<Predicate>(_p[a], _p[b], _p[i])) {
+                c = i;
+                break;
+            }
+        }
+        if (c == NONE) return false;
+        if (ccw<Predicate>(_p[a], _p[b], _p[c]) == CLOCKWISE) std::swap(b, c);
+        add_triangle(a, b, c);
+        add_triangle(b, a, _inf);
+        add_triangle(c, b, _inf);
+        add_triangle(a, c, _inf);
+        link(0, 3);
+        link(1, 6);
+        link(2, 9);
+        link(4, 11);
+        link(5, 7);
+        link(8, 10);
+        return true;
+    }
+
+    // 三角形 t の外接円が点 p を内部に含むか
+    template <class P = Predicate>
+    bool conflict(size_type t, const point_type &p) const {
+        if (is_ghost(t)) {
+            size_type e = real_edge(t);
+            ClockWise c = ccw<P>(_p[_v[e]], _p[_v[next(e)]], p);
+            return c == COUNTER_CLOCKWISE || c == ON_SEGMENT;
+        }
+        return in_circle<P>(
+            _p[_v[3 * t]], _p[_v[3 * t + 1]], _p[_v[3 * t + 2]], p);
+    }
+
+    // 三角形 t が点 p を含むか（境界を含む）。ゴーストは辺の外側の半平面
+    template <class P = Predicate>
+    bool contains(size_type t, const point_type &p) const {
+        if (is_ghost(t)) return conflict<P>(t, p);
+        for (size_type i = 0; i < 3; i++) {
+            size_type e = 3 * t + i;
+            ClockWise c = ccw<P>(_p[_v[e]], _p[_v[next(e)]], p);
+            if (c != COUNTER_CLOCKWISE && c != ON_SEGMENT) return false;
+        }
+        return true;
+    }
+
+    // 辺 e と点 p で正の向きの三角形ができるか
+    template <class P = Predicate>
+    bool visible(size_type e, const point_type &p) const {
+        size_type u = _v[e], w = _v[next(e)];
+        if (u == _inf || w == _inf) return true;
+        return ccw<P>(_p[u], _p[w], p) == COUNTER_CLOCKWISE;
+    }
+
+    /**
+     * @brief visibility walk from the last created triangle.
+     * The walk moves across an edge that separates the current triangle
+     * from p, starting from a random edge so that it does not cycle.
+     * @return a triangle containing p, or a ghost triangle in conflict
+     * with p if p is outside the hull.
+     */
+    template <class P = Predicate>
+    size_type locate(const point_type &p) {
+        const size_type m = _v.size() / 3;
+        size_type       t = _last;
+        if (is_ghost(t)) t = _h[real_edge(t)] / 3;
+        for (size_type step = 0; step <= m; step++) {
+            if (is_ghost(t)) return t;
+            _rng ^= _rng << 13;
+            _rng ^= _rng >> 17;
+            _rng ^= _rng << 5;
+            size_type r = _rng % 3, to = NONE;
+            for (size_type j = 0; j < 3 && to == NONE; j++) {
+                size_type e = 3 * t + (r + j) % 3;
+                if (ccw<P>(_p[_v[e]], _p[_v[next(e)]], p) == CLOCKWISE) {
+                    to = _h[e] / 3;
+                }
+            }
+            if (to == NONE) return t;
+            t = to;
+        }
+        // 誤差で巡回したときは全部の三角形を調べる
+        for (size_type s = 0; s < m; s++) {
+            if (contains<P>(s, p)) return s;
+        }
+        return NONE;
+    }
+
+    /**
+     * @brief collect the cavity from the triangle t.
+     * If split is false, these are the triangles whose circumcircle
+     * contains p, as in Bowyer-Watson. If split is true, these are only
+     * the triangles that contain p, which are enough to insert p into
+     * any triangulation, Delaunay or not.
+     */
+    template <class P = Predicate>
+    void collect(size_type t, const point_type &p, bool split) {
+        ++_stamp;
+        _cavity.assign(1, t);
+        _mark[t] = _stamp;
+        for (size_type k = 0; k < _cavity.size(); k++) {
+            for (size_type i = 0; i < 3; i++) {
+                size_type e = 3 * _cavity[k] + i, n = _h[e] / 3;
+                if (_mark[n] == _stamp) continue;
+                if (split ? contains<P>(n, p)
+                          : conflict<P>(n, p) || !visible<P>(e, p)) {
+                    _mark[n] = _stamp;
+                    _cavity.push_back(n);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief find a triangle to remove from the cavity.
+     * The cavity can be filled with a fan around p only if every boundary
+     * edge makes a positive triangle with p, the boundary is one simple
+     * cycle and no vertex is inside the cavity. These hold for exact
+     * predicates, but may fail with EpsilonPredicate when p is nearly
+     * on the lines through other points.
+     * @return a triangle of the cavity that breaks the conditions, the
+     * one farthest from the first triangle, or NONE if there is none.
+     */
+    template <class P = Predicate>
+    size_type broken(const point_type &p) {
+        _boundary.clear();
+        for (size_type c : _cavity) {
+            for (size_type i = 0; i < 3; i++) {
+                size_type e = 3 * c + i;
+                if (_mark[_h[e] / 3] != _stamp) _boundary.push_back(e);
+            }
+        }
+        for (size_type e : _boundary) {
+            if (!visible<P>(e, p)) return e / 3;
+        }
+        // 空洞の三角形は根から近い順に並ぶので，後に現れる方を外す
+        for (size_type e : _boundary) {
+            if (_vmark[_v[e]] == _stamp) return e / 3;
+            _vmark[_v[e]] = _stamp;
+        }
+        for (size_type k = _cavity.size(); k-- > 0;) {
+            for (size_type i = 0; i < 3; i++) {
+                if (_vmark[_v[3 * _cavity[k] + i]] != _stamp) {
+                    return _cavity[k];
+                }
+            }
+        }
+        return NONE;
+    }
+
+    // 空洞から三角形を外して p から見て星形にする。できなければ false
+    template <class P = Predicate>
+    bool repair(const point_type &p) {
+        for (size_type c = broken<P>(p); c != NONE; c = broken<P>(p)) {
+            if (c == _cavity[0]) return false;
+            // c を外し，根と辺でつながる三角形だけを残す
+            _mark[c]              = 0;
+            const size_type stamp = _stamp++;
+            _mark[_cavity[0]]     = _stamp;
+            _cavity.resize(1);
+            for (size_type k = 0; k < _cavity.size(); k++) {
+                for (size_type i = 0; i < 3; i++) {
+                    size_type n = _h[3 * _cavity[k] + i] / 3;
+                    if (_mark[n] == stamp) {
+                        _mark[n] = _stamp;
+                        _cavity.push_back(n);
+                    }
+                }
+            }
+        }
+        // 境界が閉路にならないときは埋めない
+        return _boundary.size() == _cavity.size() + 2;
+    }
+
+    void insert(size_type s) {
+        const point_type &p = _p[s];
+        const size_type   t = locate(p);
+        bool              ok = false, legal = false;
+        if (t != NONE) {
+            collect(t, p, false);
+            // 既にある点と同じ点は加えない
+            for (size_type c : _cavity) {
+                for (size_type i = 0; i < 3; i++) {
+                    size_type u = _v[3 * c + i];
+                    if (u != _inf && Predicate::equal(_p[u], p)) return;
+                }
+            }
+            const size_type n = _cavity.size();
+            ok                = repair(p);
+            // 空洞を小さくしたときは外側に p と衝突する三角形が残る
+            legal = ok && _cavity.size() == n;
+        }
+        // 誤差で空洞を作れないときは，p を含む三角形だけを厳密な判定で
+        // 分割する。作られた三角形は全て厳密に正の向きなのでこれは常に
+        // 正しい三角形分割になる
+        if (!ok) {
+            const size_type u = locate<Strict>(p);
+            if (u == NONE) return;
+            collect<Strict>(u, p, true);
+            if (!repair<Strict>(p)) return;
+        }
+        // 境界の辺と p を結ぶ三角形で空洞を埋める
+        _fan.clear();
+        for (size_type e : _boundary) {
+            _fan.push_back({_v[e], _v[next(e)], _h[e]});
+        }
+        for (size_type j = 0; j < _fan.size(); j++) {
+            size_type nt;
+            if (j < _cavity.size()) {
+                nt = _cavity[j];
+            } else {
+                nt = _v.size() / 3;
+                add_triangle(NONE, NONE, NONE);
+            }
+            _v[3 * nt]     = _fan[j][0];
+            _v[3 * nt + 1] = _fan[j][1];
+            _v[3 * nt + 2] = s;
+            link(3 * nt, _fan[j][2]);
+            _start[_fan[j][0]] = nt;
+        }
+        for (const auto &f : _fan) {
+            link(3 * _start[f[0]] + 1, 3 * _start[f[1]] + 2);
+        }
+        _last = _start[_fan[0][0]];
+        // p の向かいの辺を裏返して局所的に Delaunay にする。誤差のある
+        // 判定では裏返しが止まらないことがあるので厳密なときだけ行う
+        if (legal || !std::is_same_v<Strict, ExactPredicate>) return;
+        for (size_type j = 0; j < _fan.size(); j++) {
+            _flip.push_back(3 * _start[_fan[j][0]]);
+        }
+        while (!_flip.empty()) {
+            size_type e = _flip.back();
+            _flip.pop_back();
+            if (flip(e)) {
+                _flip.push_back(e);
+                _flip.push_back(next(_h[next(e)]));
+            }
+        }
+    }
+
+    /**
+     * @brief flip the half-edge e = ab of the triangle abp if the opposite
+     * vertex q is inside its circumcircle.
+     * Then the quadrilateral aqbp is convex, and abp and baq are replaced
+     * by aqp at e / 3 and qbp at _h[e] / 3. The half-edges opposite p are
+     * e and the one after the diagonal pq.
+     */
+    bool flip(size_type e) {
+        const size_type f = _h[e], t = e - e % 3, u = f - f % 3;
+        const size_type a = _v[e], b = _v[next(e)], c = _v[t + (e + 2) % 3];
+        const size_type q = _v[u + (f + 2) % 3];
+        if (a == _inf || b == _inf || q == _inf) return false;
+        if (!in_circle<Strict>(_p[a], _p[b], _p[c], _p[q])) return false;
+        const size_type ha = _h[next(f)], hb = _h[u + (f + 2) % 3];
+        const size_type hc = _h[next(e)], hd = _h[t + (e + 2) % 3];
+        _v[e] = a, _v[next(e)] = q, _v[t + (e + 2) % 3] = c;
+        _v[f] = q, _v[next(f)] = b, _v[u + (f + 2) % 3] = c;
+        link(e, ha);
+        link(t + (e + 2) % 3, hd);
+        link(f, hb);
+        link(next(f), hc);
+        link(next(e), u + (f + 2) % 3);
+        _last = t / 3;
+        return true;
+    }
+
+    const std::vector<point_type> &_p;
+    // ゴーストの三角形の頂点
+    const size_type        _inf;
+    std::vector<size_type> _v, _h;
+    // 空洞を探すときの印
+    std::vector<size_type> _mark, _vmark;
+    size_type              _stamp = 0, _last = 0;
+    std::uint32_t          _rng   = 2463534242u;
+    // 各頂点から始まる新しい三角形
+    std::vector<size_type> _start;
+    // 空洞の三角形，その境界の辺，新しい三角形の (始点，終点，外側の半辺)
+    std::vector<size_type>                _cavity, _boundary;
+    std::vector<std::array<size_type, 3>> _fan;
+    // 裏返すか調べる辺
+    std::vector<size_type> _flip;
+};
+
+}  // namespace internal
+
+/**
+ * @brief Delaunay triangulation by randomized incremental insertion.
+ * The points are inserted in a biased randomized order along a Hilbert
+ * curve, and each point is located by walking from the triangle created
+ * last, which is near it in this order. The triangles whose circumcircle
+ * contains the new point are replaced by a fan around it.
+ * The result is stored in two arrays of half-edges. The triangle t has
+ * the half-edges 3t, 3t + 1 and 3t + 2 in counterclockwise order, and
+ * the half-edge e starts at triangles()[e] and ends at
+ * triangles()[next(e)]. halfedges()[e] is the opposite half-edge in the
+ * adjacent triangle, or NONE on the convex hull.
+ * Only one of equal points is used, where Predicate::equal decides if
+ * two points are equal: EpsilonPredicate compares with EPS and
+ * ExactPredicate compares the coordinates exactly. If all the points are
+ * on a line, there is no triangle.
+ * When EpsilonPredicate cannot make a star-shaped cavity around a point
+ * nearly on the lines through others, only the triangles that contain it
+ * are split, with exact predicates if T fits in Real. The points that
+ * are still not inserted are listed by skipped().
+ * @tparam Predicate EpsilonPredicate by default. Give ExactPredicate of
+ * robust_predicate.hpp for inputs with many cocircular points.
+ */
+template <class T, class Predicate = EpsilonPredicate>
+class BasicDelaunay {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+    using point_type = BasicPoint<T>;
+
+    static constexpr size_type NONE = size_type(-1);
+
+    /**
+     * @brief triangulate the points in O(n log n) expected time.
+     * @param seed seed of the random insertion order
+     */
+    explicit BasicDelaunay(const std::vector<point_type> &points,
+                           std::uint32_t                  seed = 0) {
+        internal::DelaunayBuilder<T, Predicate>(points, seed)
+            .extract(_triangles, _halfedges);
+        std::vector<bool> used(points.size(), false);
+        for (size_type v : _triangles) used[v] = true;
+        for (size_type i = 0; i < points.size(); i++) {
+            if (!used[i]) _skipped.push_back(i);
+        }
+    }
+
+    // 三角形の個数
+    size_type size() const noexcept {
+        return _triangles.size() / 3;
+    }
+
+    bool empty() const noexcept {
+        return _triangles.empty();
+    }
+
+    // 三角形 t の頂点の番号（反時計回り）
+    std::array<size_type, 3> triangle(size_type t) const {
+        return {
+            _triangles[3 * t], _triangles[3 * t + 1], _triangles[3 * t + 2]};
+    }
+
+    const std::vector<size_type> &triangles() const noexcept {
+        return _triangles;
+    }
+
+    const std::vector<size_type> &halfedges() const noexcept {
+        return _halfedges;
+    }
+
+    /**
+     * @brief indexes of the points that are not a vertex of any triangle.
+     * These are the points equal to another one, or all the points if
+     * they are on a line. Other points are skipped only if the predicate
+     * cannot insert them consistently, which does not happen with
+     * ExactPredicate.
+     */
+    const std::vector<size_type> &skipped() const noexcept {
+        return _skipped;
+    }
+
+    // 同じ三角形の次の半辺
+    static size_type next(size_type e) {
+        return e % 3 == 2 ? e - 2 : e + 1;
+    }
+
+    // 同じ三角形の前の半辺
+    static size_type prev(size_type e) {
+        return e % 3 == 0 ? e + 2 : e - 1;
+    }
+
+   private:
+    std::vector<size_type> _triangles, _halfedges, _skipped;
+};
+
+using Delaunay = BasicDelaunay<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_DELAUNAY_HPP_
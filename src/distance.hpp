@@ -15,24 +15,32 @@ namespace sapphre15 {
 
 namespace geometry {
 
-Real distance(const Line &l1, const Line &l2) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicLine<T> &l1,
+                                                  const BasicLine<T> &l2) {
     return parallel(l1, l2) ? distance(l1, l2._a) : 0;
 }
 
-Real distance(const Segment &l, const Point &p) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicSegment<T> &l,
+                                                  const BasicPoint<T>   &p) {
     auto dd = dot(p - l.start(), l.end() - l.start());
     if (0 <= dd && dd <= norm(l.end() - l.start())) {
-        return distance((Line)l, p);
+        return distance(BasicLine<T>(l), p);
     } else {
         return std::min(distance(l.start(), p), distance(l.end(), p));
     }
 }
 
-Real distance(const Point &p, const Segment &l) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicPoint<T>   &p,
+                                                  const BasicSegment<T> &l) {
     return distance(l, p);
 }
 
-Real distance(const Segment &l1, const Line &l2) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicSegment<T> &l1,
+                                                  const BasicLine<T>    &l2) {
     if (intersection(l1, l2)) {
         return 0;
     } else {
@@ -40,13 +48,17 @@ Real distance(const Segment &l1, const Line &l2) {
     }
 }
 
-Real distance(const Line &l1, const Segment &l2) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicLine<T>    &l1,
+                                                  const BasicSegment<T> &l2) {
     return distance(l2, l1);
 }
 
 // verified with
 // https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/2/CGL_2_D
-Real distance(const Segment &l1, const Segment &l2) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicSegment<T> &l1,
+                                                  const BasicSegment<T> &l2) {
     if (intersection(l1, l2))
         return 0.0;
     else
@@ -56,9 +68,11 @@ Real distance(const Segment &l1, const Segment &l2) {
                          distance(l2, l1.end())});
 }
 
-Real distance(const Circle &c, const Line &l) {
-    Real d = distance(c.center(), l);
-    return std::max(d - c.radius(), 0.0);
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicCircle<T> &c,
+                                                  const BasicLine<T>   &l) {
+    typename coordinate_traits<T>::real_type d = distance(c.center(), l);
+    return std::max(d - c.radius(), decltype(d)(0));
     /**
      * This implementation calculates more accurately
      * especially when the circle's radius and
@@ -75,7 +89,9 @@ Real distance(const Circle &c, const Line &l) {
      */
 }
 
-Real distance(const Line &l, const Circle &c) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicLine<T>   &l,
+                                                  const BasicCircle<T> &c) {
     return distance(c, l);
 }
 
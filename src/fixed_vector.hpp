@@ -0,0 +1,171 @@
+#ifndef GEOMETRY_FIXED_VECTOR_HPP_
+#define GEOMETRY_FIXED_VECTOR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief 要素数が高々 N 個の可変長配列
+ * 要素をオブジェクト内に持つので，構築や返却でヒープ確保が起きない。
+ * cross_point や tangent の返り値に用いる。
+ * std::vector へ暗黙に変換でき，std::vector と比較できる。
+ * T はデフォルト構築可能である必要がある。
+ */
+template <class T, std::size_t N>
+class FixedVector {
+   public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = T &;
+    using const_reference = const T &;
+    using iterator        = T *;
+    using const_iterator  = const T *;
+
+    FixedVector() : _size(0), _data() {
+    }
+
+    FixedVector(std::initializer_list<T> init) : FixedVector() {
+        assert(init.size() <= N);
+        for (const T &v : init) _data[_size++] = v;
+    }
+
+    template <class InputIterator>
+    FixedVector(InputIterator first, InputIterator last) : FixedVector() {
+        for (; first != last; ++first) push_back(*first);
+    }
+
+    size_type size() const noexcept {
+        return _size;
+    }
+
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    static constexpr size_type capacity() noexcept {
+        return N;
+    }
+
+    static constexpr size_type max_size() noexcept {
+        return N;
+    }
+
+    reference operator[](size_type n) {
+        assert(n < _size);
+        return _data[n];
+    }
+
+    const_reference operator[](size_type n) const {
+        assert(n < _size);
+        return _data[n];
+    }
+
+    reference front() {
+        return (*this)[0];
+    }
+
+    const_reference front() const {
+        return (*this)[0];
+    }
+
+    reference back() {
+        return (*this)[_size - 1];
+    }
+
+    const_reference back() const {
+        return (*this)[_size - 1];
+    }
+
+    T *data() noexcept {
+        return _data;
+    }
+
+    const T *data() const noexcept {
+        return _data;
+    }
+
+    iterator begin() noexcept {
+        return _data;
+    }
+
+    const_iterator begin() const noexcept {
+        return _data;
+    }
+
+    iterator end() noexcept {
+        return _data + _size;
+    }
+
+    const_iterator end() const noexcept {
+        return _data + _size;
+    }
+
+    void push_back(const T &v) {
+        assert(_size < N);
+        _data[_size++] = v;
+    }
+
+    void pop_back() {
+        assert(0 < _size);
+        _size--;
+    }
+
+    void clear() noexcept {
+        _size = 0;
+    }
+
+    // std::vector への変換
+    operator std::vector<T>() const {
+        return std::vector<T>(begin(), end());
+    }
+
+   private:
+    size_type _size;
+    T         _data[N];
+};
+
+template <class T, std::size_t N, std::size_t M>
+bool operator==(const FixedVector<T, N> &lhs, const FixedVector<T, M> &rhs) {
+    return std::equal(
+        std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <class T, std::size_t N>
+bool operator==(const FixedVector<T, N> &lhs, const std::vector<T> &rhs) {
+    return std::equal(
+        std::begin(lhs), std::end(lhs), std::begin(rhs), std::end(rhs));
+}
+
+template <class T, std::size_t N>
+bool operator==(const std::vector<T> &lhs, const FixedVector<T, N> &rhs) {
+    return rhs == lhs;
+}
+
+template <class T, std::size_t N, std::size_t M>
+bool operator!=(const FixedVector<T, N> &lhs, const FixedVector<T, M> &rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, std::size_t N>
+bool operator!=(const FixedVector<T, N> &lhs, const std::vector<T> &rhs) {
+    return !(lhs == rhs);
+}
+
+template <class T, std::size_t N>
+bool operator!=(const std::vector<T> &lhs, const FixedVector<T, N> &rhs) {
+    return !(lhs == rhs);
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_FIXED_VECTOR_HPP_
@@ -0,0 +1,175 @@
+#ifndef GEOMETRY_HALF_PLANE_INTERSECTION_HPP_
+#define GEOMETRY_HALF_PLANE_INTERSECTION_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "line.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief shape of the intersection of half-planes.
+ */
+enum class HalfPlaneStatus {
+    EMPTY     = 0,  // 面積をもたない
+    BOUNDED   = 1,  // 凸多角形
+    UNBOUNDED = 2,  // 有界でない，または空
+};
+
+namespace internal {
+
+// 点と方向の組で表した半平面
+template <class T>
+using half_plane = std::pair<BasicPoint<T>, BasicPoint<T>>;
+
+// 2本の境界線の交点
+template <class T>
+BasicPoint<T> half_plane_meet(const half_plane<T> &g, const half_plane<T> &h) {
+    using R = typename coordinate_traits<T>::real_type;
+    R t     = R(cross(h.first - g.first, h.second)) /
+          R(cross(g.second, h.second));
+    return round_point<T>(BasicPoint<R>(g.first) + BasicPoint<R>(g.second) * t);
+}
+
+}  // namespace internal
+
+/**
+ * @brief intersect the left sides of the directed lines in O(n log n)
+ * time, writing the vertexes into a buffer.
+ * The half-planes are sorted by the angle of their directions with an
+ * exact comparator, and a deque keeps the boundary of the intersection
+ * of the ones seen so far. Parallel directions are found by the exact
+ * sign of the cross product of the direction vectors b - a, which are
+ * rounded to T, and only the point tests use Predicate.
+ * If the directions leave an angle of pi or more uncovered, no bounded
+ * region is possible and UNBOUNDED is returned without checking if the
+ * intersection is empty. Add the sides of a bounding box in that case.
+ * For integer coordinates, the vertexes are rounded to the nearest
+ * integers.
+ * @param lines Line. The left side of each line, including the line, is
+ * taken.
+ * @param out vertexes in counterclockwise order if the result is BOUNDED,
+ * and empty otherwise.
+ * @return HalfPlaneStatus
+ */
+template <class Predicate = EpsilonPredicate, class T>
+HalfPlaneStatus half_plane_intersection(const std::vector<BasicLine<T>> &lines,
+                                        std::vector<BasicPoint<T>>      &out) {
+    using H = internal::half_plane<T>;
+    out.clear();
+    std::vector<H> hs;
+    hs.reserve(lines.size());
+    for (const BasicLine<T> &l : lines) {
+        auto [a, b] = l.points();
+        hs.emplace_back(a, b - a);
+    }
+    // 向きの比較は全て外積の厳密な符号で行う
+    auto parallel = [](const H &g, const H &h) {
+        return internal::cross_sign(g.second, h.second) == 0;
+    };
+    auto same = [&parallel](const H &g, const H &h) {
+        return internal::angle_half(g.second) ==
+                   internal::angle_half(h.second) &&
+               parallel(g, h);
+    };
+    std::sort(std::begin(hs), std::end(hs), [](const H &g, const H &h) {
+        return angle_less(g.second, h.second);
+    });
+    // 同じ向きの半平面は最も狭いものだけを残す
+    std::size_t m = 0;
+    for (std::size_t i = 0; i < hs.size(); i++) {
+        if (m == 0 || !same(hs[m - 1], hs[i])) {
+            hs[m++] = hs[i];
+        } else if (internal::cross_sign(hs[m - 1].second,
+                                        hs[i].first - hs[m - 1].first) > 0) {
+            hs[m - 1] = hs[i];
+        }
+    }
+    hs.resize(m);
+    // 隣り合う向きの間が pi 以上開いていれば有界にならない
+    if (m < 3) return HalfPlaneStatus::UNBOUNDED;
+    for (std::size_t i = 0; i < m; i++) {
+        const auto &d = hs[i].second, &e = hs[(i + 1) % m].second;
+        int         c = internal::cross_sign(d, e);
+        if (c < 0 || (c == 0 && dot(d, e) < 0)) {
+            return HalfPlaneStatus::UNBOUNDED;
+        }
+    }
+    auto outside = [](const H &h, const BasicPoint<T> &p) {
+        return ccw<Predicate>(h.first, h.first + h.second, p) == CLOCKWISE;
+    };
+    // dq[lo, hi) を両端キューとして使う
+    std::vector<H> dq(m);
+    std::size_t    lo = 0, hi = 0;
+    for (const H &h : hs) {
+        while (hi - lo >= 2 &&
+               outside(h, internal::half_plane_meet(dq[hi - 2], dq[hi - 1]))) {
+            hi--;
+        }
+        while (hi - lo >= 2 &&
+               outside(h, internal::half_plane_meet(dq[lo], dq[lo + 1]))) {
+            lo++;
+        }
+        // 逆向きの半平面どうしが隣り合うなら共通部分は空
+        if (hi - lo >= 1 && parallel(dq[hi - 1], h)) {
+            return HalfPlaneStatus::EMPTY;
+        }
+        dq[hi++] = h;
+    }
+    while (hi - lo >= 3 &&
+           outside(dq[lo], internal::half_plane_meet(dq[hi - 2], dq[hi - 1]))) {
+        hi--;
+    }
+    while (hi - lo >= 3 &&
+           outside(dq[hi - 1], internal::half_plane_meet(dq[lo], dq[lo + 1]))) {
+        lo++;
+    }
+    if (hi - lo < 3 || parallel(dq[hi - 1], dq[lo])) {
+        return HalfPlaneStatus::EMPTY;
+    }
+    for (std::size_t i = lo; i < hi; i++) {
+        out.push_back(
+            internal::half_plane_meet(dq[i], dq[i + 1 < hi ? i + 1 : lo]));
+    }
+    typename coordinate_traits<T>::product_type area2 = 0;
+    for (std::size_t i = 0; i < out.size(); i++) {
+        area2 += cross(out[i], out[(i + 1) % out.size()]);
+    }
+    if (sgn(area2) <= 0) {
+        out.clear();
+        return HalfPlaneStatus::EMPTY;
+    }
+    return HalfPlaneStatus::BOUNDED;
+}
+
+/**
+ * @brief intersect the left sides of the directed lines in O(n log n)
+ * time. See the overload with a buffer for details.
+ * @return Polygon if the intersection is bounded and has a positive
+ * area, and std::nullopt otherwise.
+ */
+template <class Predicate = EpsilonPredicate, class T>
+std::optional<BasicPolygon<T>> half_plane_intersection(
+    const std::vector<BasicLine<T>> &lines) {
+    std::vector<BasicPoint<T>> out;
+    if (half_plane_intersection<Predicate>(lines, out) !=
+        HalfPlaneStatus::BOUNDED) {
+        return std::nullopt;
+    }
+    return BasicPolygon<T>(out);
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_HALF_PLANE_INTERSECTION_HPP_
@@ -20,7 +20,8 @@ namespace geometry {
  * @param b Line
  * @return bool
  */
-bool intersection(const Line &a, const Line &b) {
+template <class T>
+bool intersection(const BasicLine<T> &a, const BasicLine<T> &b) {
     return !parallel(a, b);
 }
 
@@ -30,8 +31,9 @@ bool intersection(const Line &a, const Line &b) {
  * @param b Line
  * @return bool
  */
-bool intersection(const Segment &a, const Line &b) {
-    std::pair<Point, Point> p = a.end_points();
+template <class T>
+bool intersection(const BasicSegment<T> &a, const BasicLine<T> &b) {
+    std::pair<BasicPoint<T>, BasicPoint<T>> p = a.end_points();
     if (b.on_object(p.first) || b.on_object(p.second)) return true;
     return ccw(b._a, b._b, p.first) * ccw(b._a, b._b, p.second) < 0;
 }
@@ -42,7 +44,8 @@ bool intersection(const Segment &a, const Line &b) {
  * @param b Segment
  * @return bool
  */
-bool intersection(const Line &a, const Segment &b) {
+template <class T>
+bool intersection(const BasicLine<T> &a, const BasicSegment<T> &b) {
     return intersection(b, a);
 }
 
@@ -54,9 +57,14 @@ https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/2/CGL_2_B
  * @param b Segment
  * @return bool
  */
-bool intersection(const Segment &a, const Segment &b) {
-    return intersection(a, (internal::LineBase)b) &&
-           intersection(b, (internal::LineBase)a);
+template <class T>
+bool intersection(const BasicSegment<T> &a, const BasicSegment<T> &b) {
+    // 一直線上にあって離れている場合は ONLINE_FRONT どうしか
+    // ONLINE_BACK どうしになり，積が正になる
+    const BasicPoint<T> a1 = a.start(), a2 = a.end(), b1 = b.start(),
+                        b2 = b.end();
+    return ccw(a1, a2, b1) * ccw(a1, a2, b2) <= 0 &&
+           ccw(b1, b2, a1) * ccw(b1, b2, a2) <= 0;
 }
 
 /**
@@ -78,9 +86,11 @@ enum class IntersectionCC {
  * @param b Circle
  * @return IntersectionCC
  */
-IntersectionCC intersection(const Circle &a, const Circle &b) {
-    Real d1 = distance(a.center(), b.center()), d2 = a.radius() + b.radius(),
-         d3 = std::abs(a.radius() - b.radius());
+template <class T>
+IntersectionCC intersection(const BasicCircle<T> &a, const BasicCircle<T> &b) {
+    using R = typename coordinate_traits<T>::real_type;
+    R d1 = distance(a.center(), b.center()), d2 = a.radius() + b.radius(),
+      d3 = std::abs(a.radius() - b.radius());
     if (eq(d1, d2))
         return IntersectionCC::CIRCUMSCRIBE;
     else if (eq(d1, d3))
@@ -108,8 +118,9 @@ enum IntersectionCL {
  * @param l Line
  * @return IntersectionCL
  */
-IntersectionCL intersection(const Circle &c, const Line &l) {
-    Real _d = distance(c.center(), l);
+template <class T>
+IntersectionCL intersection(const BasicCircle<T> &c, const BasicLine<T> &l) {
+    typename coordinate_traits<T>::real_type _d = distance(c.center(), l);
     if (eq(_d, c.radius()))
         return IntersectionCL::TOUCH;
     else if (le(_d, c.radius()))
@@ -124,7 +135,8 @@ IntersectionCL intersection(const Circle &c, const Line &l) {
  * @param c Circle
  * @return IntersectionCL
  */
-IntersectionCL intersection(const Line &l, const Circle &c) {
+template <class T>
+IntersectionCL intersection(const BasicLine<T> &l, const BasicCircle<T> &c) {
     return intersection(c, l);
 }
 
@@ -0,0 +1,275 @@
+#ifndef GEOMETRY_KD_TREE_HPP_
+#define GEOMETRY_KD_TREE_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief Static 2-d tree for nearest neighbor queries.
+ * The tree is a complete binary tree stored in breadth-first order, so
+ * the children of the node k are 2k + 1 and 2k + 2 and no pointers are
+ * needed. The nodes of depth d split the points by the x-coordinate if
+ * d is even and by the y-coordinate otherwise.
+ * Distances are compared by norm, and the results are reported as
+ * squared distances with the indices of the points given at
+ * construction.
+ */
+template <class T>
+class BasicKdTree {
+   public:
+    using value_type   = T;
+    using size_type    = std::size_t;
+    using point_type   = BasicPoint<T>;
+    using real_type    = typename coordinate_traits<T>::real_type;
+    using product_type = typename coordinate_traits<T>::product_type;
+    // 点の番号と距離の2乗
+    using result_type = std::pair<size_type, product_type>;
+
+    /**
+     * @brief build the tree in O(n log n) time.
+     * @param points Point
+     * @param threads number of threads used to build the subtrees.
+     */
+    explicit BasicKdTree(const std::vector<point_type> &points,
+                         size_type                      threads = 1)
+        : _n(points.size()), _p(points.size()), _id(points.size()) {
+        std::vector<std::pair<point_type, size_type>> buf(_n);
+        for (size_type i = 0; i < _n; i++) buf[i] = {points[i], i};
+        build(buf.data(), _n, 0, 0, std::max<size_type>(threads, 1));
+    }
+
+    size_type size() const noexcept {
+        return _n;
+    }
+
+    bool empty() const noexcept {
+        return _n == 0;
+    }
+
+    /**
+     * @brief find the nearest point to q.
+     * The tree must not be empty.
+     * @return (index, squared distance)
+     */
+    result_type nearest(const point_type &q) const {
+        assert(!empty());
+        result_type best(_id[0], norm(_p[0] - q));
+        nearest(q, 0, 0, best);
+        return best;
+    }
+
+    /**
+     * @brief find the k nearest points to q.
+     * @return (index, squared distance) in ascending order of the
+     * distance. It has min(k, size()) elements.
+     */
+    std::vector<result_type> k_nearest(const point_type &q,
+                                       size_type         k) const {
+        std::priority_queue<std::pair<product_type, size_type>> heap;
+        if (k > 0) k_nearest(q, k, 0, 0, heap);
+        std::vector<result_type> ret(heap.size());
+        for (size_type i = ret.size(); i-- > 0; heap.pop()) {
+            ret[i] = {heap.top().second, heap.top().first};
+        }
+        return ret;
+    }
+
+    /**
+     * @brief find the points whose distance from q is at most r.
+     * @return indices of the points in unspecified order.
+     */
+    std::vector<size_type> within_radius(const point_type &q,
+                                         real_type         r) const {
+        std::vector<size_type> ret;
+        within_radius(q, r * r, 0, 0, ret);
+        return ret;
+    }
+
+    /**
+     * @brief find the nearest point to each query.
+     * @param threads the queries are split among this number of threads.
+     */
+    std::vector<result_type> nearest(const std::vector<point_type> &qs,
+                                     size_type threads = 1) const {
+        std::vector<result_type> ret(qs.size());
+        for_each_query(qs.size(), threads, [&](size_type i) {
+            ret[i] = nearest(qs[i]);
+        });
+        return ret;
+    }
+
+    /**
+     * @brief find the k nearest points to each query.
+     * @param threads the queries are split among this number of threads.
+     */
+    std::vector<std::vector<result_type>> k_nearest(
+        const std::vector<point_type> &qs,
+        size_type                      k,
+        size_type                      threads = 1) const {
+        std::vector<std::vector<result_type>> ret(qs.size());
+        for_each_query(qs.size(), threads, [&](size_type i) {
+            ret[i] = k_nearest(qs[i], k);
+        });
+        return ret;
+    }
+
+   private:
+    using element = std::pair<point_type, size_type>;
+
+    // 並列化するときの1スレッドあたりの最小の点数
+    static constexpr size_type MIN_CHUNK = 1 << 14;
+
+    // 頂点数 n の完全二分木の左の部分木の頂点数
+    static size_type left_size(size_type n) {
+        if (n <= 1) return 0;
+        size_type h = 0;
+        while ((size_type(2) << h) <= n) h++;
+        // 最下段を除いた左の部分木の頂点数と，最下段の頂点数
+        size_type half = size_type(1) << (h - 1),
+                  last = n - ((size_type(1) << h) - 1);
+        return half - 1 + std::min(last, half);
+    }
+
+    static T coord(const point_type &p, size_type depth) {
+        return depth % 2 == 0 ? p.x() : p.y();
+    }
+
+    // buf[0, n) から頂点 k を根とする部分木を作る
+    void build(element  *buf,
+               size_type n,
+               size_type k,
+               size_type depth,
+               size_type threads) {
+        if (n == 0) return;
+        const size_type m = left_size(n);
+        std::nth_element(
+            buf, buf + m, buf + n, [depth](const element &a, const element &b) {
+                return coord(a.first, depth) < coord(b.first, depth);
+            });
+        _p[k]  = buf[m].first;
+        _id[k] = buf[m].second;
+        if (threads > 1 && n >= 2 * MIN_CHUNK) {
+            std::thread worker([&] {
+                build(buf, m, 2 * k + 1, depth + 1, threads / 2);
+            });
+            build(buf + m + 1,
+                  n - m - 1,
+                  2 * k + 2,
+                  depth + 1,
+                  threads - threads / 2);
+            worker.join();
+        } else {
+            build(buf, m, 2 * k + 1, depth + 1, 1);
+            build(buf + m + 1, n - m - 1, 2 * k + 2, depth + 1, 1);
+        }
+    }
+
+    // 分割する軸の方向の差の2乗
+    product_type axis_dist(const point_type &q,
+                           size_type         k,
+                           size_type         depth) const {
+        product_type d = product_type(coord(q, depth)) -
+                         product_type(coord(_p[k], depth));
+        return d * d;
+    }
+
+    void nearest(const point_type &q,
+                 size_type         k,
+                 size_type         depth,
+                 result_type      &best) const {
+        if (k >= _n) return;
+        product_type d = norm(_p[k] - q);
+        if (d < best.second) best = {_id[k], d};
+        // q がある側から先に探す
+        bool      left = coord(q, depth) < coord(_p[k], depth);
+        size_type near = 2 * k + (left ? 1 : 2), far = 2 * k + (left ? 2 : 1);
+        nearest(q, near, depth + 1, best);
+        if (axis_dist(q, k, depth) < best.second) {
+            nearest(q, far, depth + 1, best);
+        }
+    }
+
+    void k_nearest(
+        const point_type                                        &q,
+        size_type                                                k_max,
+        size_type                                                k,
+        size_type                                                depth,
+        std::priority_queue<std::pair<product_type, size_type>> &heap) const {
+        if (k >= _n) return;
+        product_type d = norm(_p[k] - q);
+        if (heap.size() < k_max) {
+            heap.emplace(d, _id[k]);
+        } else if (d < heap.top().first) {
+            heap.pop();
+            heap.emplace(d, _id[k]);
+        }
+        bool      left = coord(q, depth) < coord(_p[k], depth);
+        size_type near = 2 * k + (left ? 1 : 2), far = 2 * k + (left ? 2 : 1);
+        k_nearest(q, k_max, near, depth + 1, heap);
+        if (heap.size() < k_max || axis_dist(q, k, depth) < heap.top().first) {
+            k_nearest(q, k_max, far, depth + 1, heap);
+        }
+    }
+
+    void within_radius(const point_type       &q,
+                       real_type               r2,
+                       size_type               k,
+                       size_type               depth,
+                       std::vector<size_type> &out) const {
+        if (k >= _n) return;
+        if (le(real_type(norm(_p[k] - q)), r2)) out.push_back(_id[k]);
+        bool      left = coord(q, depth) < coord(_p[k], depth);
+        size_type near = 2 * k + (left ? 1 : 2), far = 2 * k + (left ? 2 : 1);
+        within_radius(q, r2, near, depth + 1, out);
+        if (le(real_type(axis_dist(q, k, depth)), r2)) {
+            within_radius(q, r2, far, depth + 1, out);
+        }
+    }
+
+    // クエリ 0, ..., n - 1 を threads 個のスレッドに分けて処理する
+    template <class Function>
+    static void for_each_query(size_type n, size_type threads, Function f) {
+        threads = std::max<size_type>(1, std::min(threads, n));
+        if (threads == 1) {
+            for (size_type i = 0; i < n; i++) f(i);
+            return;
+        }
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (size_type t = 0; t < threads; t++) {
+            workers.emplace_back([&, t] {
+                for (size_type i = t * n / threads; i < (t + 1) * n / threads;
+                     i++) {
+                    f(i);
+                }
+            });
+        }
+        for (std::thread &worker : workers) worker.join();
+    }
+
+    const size_type _n;
+    // 幅優先順に並べた頂点と，その点の元の番号
+    std::vector<point_type> _p;
+    std::vector<size_type>  _id;
+};
+
+using KdTree = BasicKdTree<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_KD_TREE_HPP_
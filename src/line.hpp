@@ -3,20 +3,31 @@
 
 #include <cassert>
 #include <cmath>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "config.hpp"
+#include "fixed_vector.hpp"
 #include "point.hpp"
 
 namespace sapphre15 {
 
 namespace geometry {
 
-Point projection(const internal::LineBase &l, const Point &p);
-Real  angle(const internal::LineBase &a, const internal::LineBase &b);
-bool  parallel(const internal::LineBase &a, const internal::LineBase &b);
-bool  orthogonal(const internal::LineBase &a, const internal::LineBase &b);
+template <class T>
+BasicPoint<T> projection(const internal::BasicLineBase<T> &l,
+                         const BasicPoint<T>              &p);
+template <class T>
+typename coordinate_traits<T>::real_type angle(
+    const internal::BasicLineBase<T> &a,
+    const internal::BasicLineBase<T> &b);
+template <class T>
+bool parallel(const internal::BasicLineBase<T> &a,
+              const internal::BasicLineBase<T> &b);
+template <class T>
+bool orthogonal(const internal::BasicLineBase<T> &a,
+                const internal::BasicLineBase<T> &b);
 
 namespace internal {
 
@@ -24,53 +35,60 @@ namespace internal {
 namespace PARENT = ::sapphre15::geometry;
 
 /**
- * @brief Base class of line like classes
+ * @brief Base class of line like classes.
+ * It has no virtual functions, so that derived classes consist of just two
+ * points and are trivially copyable. Do not use it polymorphically.
  */
-class LineBase {
+template <class T>
+class BasicLineBase {
+   public:
+    using value_type = T;
+    using real_type  = typename coordinate_traits<T>::real_type;
+    using point_type = BasicPoint<T>;
+
    protected:
-    Point _a, _b;
+    point_type _a, _b;
 
    public:
-    virtual ~LineBase() {
-    }
-
     // x+y = 1
-    LineBase() : _a(1, 0), _b(0, 1) {
+    BasicLineBase() : _a(1, 0), _b(0, 1) {
     }
     // 点a, bを結ぶ直線
-    LineBase(const Point &a, const Point &b) : _a(a), _b(b) {
+    BasicLineBase(const point_type &a, const point_type &b) : _a(a), _b(b) {
     }
     // ax + by + c = 0
-    LineBase(const Real &a, const Real &b, const Real &c) {
-        assert(!eq(a, 0.0) || !eq(b, 0.0));
-        if (eq(a, 0.0)) {
-            _a = Point(0.0, -c / b);
-            _b = Point(1.0, -c / b);
+    BasicLineBase(const value_type &a,
+                  const value_type &b,
+                  const value_type &c) {
+        assert(!eq(a, value_type(0)) || !eq(b, value_type(0)));
+        if (eq(a, value_type(0))) {
+            _a = point_type(0, -c / b);
+            _b = point_type(1, -c / b);
         } else {
-            _a = Point(-c / a, 0.0);
-            _b = Point(-(c + b) / a, 1.0);
+            _a = point_type(-c / a, 0);
+            _b = point_type(-(c + b) / a, 1);
         }
     }
     // 点p を通り，偏角 theta の直線
-    LineBase(const Point &p, const Real theta)
-        : _a(p), _b(p + Point::polar(theta)) {
+    BasicLineBase(const point_type &p, const real_type theta)
+        : _a(p), _b(p + point_type::polar(theta)) {
     }
     // 直線上に点があるかを判定する
-    bool on_line(const Point &p) const {
+    bool on_line(const point_type &p) const {
         ClockWise val = ccw(_a, _b, p);
         return val != CLOCKWISE && val != COUNTER_CLOCKWISE;
     }
     // 直線の単位方向ベクトルを返す
-    Point direction() const {
+    point_type direction() const {
         return (_b - _a) / abs(_b - _a);
     }
-    // 図形上に点があるか
-    virtual bool on_object(const Point &p) const {
+    // 図形上に点があるか。派生クラスはこれを隠蔽する
+    bool on_object(const point_type &p) const {
         return on_line(p);
     }
     // 直線の傾き
-    Real slope() const {
-        return (_a.y() - _b.y()) / (_a.x() - _b.x());
+    real_type slope() const {
+        return real_type(_a.y() - _b.y()) / real_type(_a.x() - _b.x());
     }
     // 直線は平行か
     bool is_horizontal() const {
@@ -81,10 +99,19 @@ class LineBase {
         return eq(_a.x(), _b.x());
     }
 
-    friend Point PARENT::projection(const LineBase &l, const Point &p);
-    friend Real  PARENT::angle(const LineBase &a, const LineBase &b);
-    friend bool  PARENT::parallel(const LineBase &a, const LineBase &b);
-    friend bool  PARENT::orthogonal(const LineBase &a, const LineBase &b);
+    template <class U>
+    friend BasicPoint<U> PARENT::projection(const BasicLineBase<U> &l,
+                                            const BasicPoint<U>    &p);
+    template <class U>
+    friend typename coordinate_traits<U>::real_type PARENT::angle(
+        const BasicLineBase<U> &a,
+        const BasicLineBase<U> &b);
+    template <class U>
+    friend bool PARENT::parallel(const BasicLineBase<U> &a,
+                                 const BasicLineBase<U> &b);
+    template <class U>
+    friend bool PARENT::orthogonal(const BasicLineBase<U> &a,
+                                   const BasicLineBase<U> &b);
 };
 
 }  // namespace internal
@@ -92,12 +119,21 @@ class LineBase {
 /**
  * @brief Line class
  */
-class Line : public internal::LineBase {
+template <class T>
+class BasicLine : public internal::BasicLineBase<T> {
+    using Base = internal::BasicLineBase<T>;
+    using Base::_a;
+    using Base::_b;
+
    public:
+    using typename Base::point_type;
+    using typename Base::real_type;
+    using typename Base::value_type;
+
     /**
      * @brief Construct a new Line object. x + y = 1.
      */
-    Line() : internal::LineBase() {
+    BasicLine() : Base() {
     }
     /**
      * @brief Construct a new Line object that
@@ -105,7 +141,7 @@ class Line : public internal::LineBase {
      * @param a Point
      * @param b Point
      */
-    Line(const Point &a, const Point &b) : internal::LineBase(a, b) {
+    BasicLine(const point_type &a, const point_type &b) : Base(a, b) {
     }
     /**
      * @brief Construct a new Line object. ax + by + c = 0
@@ -113,8 +149,8 @@ class Line : public internal::LineBase {
      * @param b Real
      * @param c Real
      */
-    Line(const Real &a, const Real &b, const Real &c)
-        : internal::LineBase(a, b, c) {
+    BasicLine(const value_type &a, const value_type &b, const value_type &c)
+        : Base(a, b, c) {
     }
     // line that pass through point p and
     /**
@@ -124,45 +160,66 @@ class Line : public internal::LineBase {
      * @param p Point
      * @param theta argument angle in radian
      */
-    Line(const Point &p, const Real theta) : internal::LineBase(p, theta) {
+    BasicLine(const point_type &p, const real_type theta) : Base(p, theta) {
     }
     /**
      * @brief down cast from LineBase to Line
      * @param l LineBase
      */
-    Line(const internal::LineBase &l) : internal::LineBase(l) {
+    BasicLine(const Base &l) : Base(l) {
     }
     /**
      * @brief return line that is translated by v
      * @param v vector of traslation
      * @return Line
      */
-    Line translation(const Point &v) const {
-        return Line(_a + v, _b + v);
+    BasicLine translation(const point_type &v) const {
+        return BasicLine(_a + v, _b + v);
     }
     /**
      * @brief return line that is translated by dist to x-axis direction.
      * @param dist distance to translate
      * @return Line
      */
-    Line moveX(const Real &dist) const {
-        return translation(Point(dist, 0.0));
+    BasicLine moveX(const value_type &dist) const {
+        return translation(point_type(dist, 0));
     }
     /**
      * @brief return line that is translated by dist to y-axis direction.
      * @param dist distance to translate
      * @return Line
      */
-    Line moveY(const Real &dist) const {
-        return translation(Point(0.0, dist));
+    BasicLine moveY(const value_type &dist) const {
+        return translation(point_type(0, dist));
+    }
+    /**
+     * @brief return the two points that define the line.
+     * The direction of the line is from the first to the second.
+     * @return std::pair<Point, Point>
+     */
+    std::pair<point_type, point_type> points() const {
+        return std::make_pair(_a, _b);
     }
 
-    friend std::vector<Point> cross_point(const Line &a, const Line &b);
-    friend bool               intersection(const Segment &a, const Line &b);
-    friend Real               distance(const Line &a, const Point &b);
-    friend Real               distance(const Line &a, const Line &b);
+    template <class U>
+    friend FixedVector<BasicPoint<U>, 2> cross_point(const BasicLine<U> &a,
+                                                     const BasicLine<U> &b);
+    template <class U>
+    friend bool intersection(const BasicSegment<U> &a, const BasicLine<U> &b);
+    template <class U>
+    friend typename coordinate_traits<U>::real_type distance(
+        const BasicLine<U>  &a,
+        const BasicPoint<U> &b);
+    template <class U>
+    friend typename coordinate_traits<U>::real_type distance(
+        const BasicLine<U> &a,
+        const BasicLine<U> &b);
 };
 
+static_assert(std::is_trivially_copyable<Line>::value,
+              "Line must be trivially copyable");
+static_assert(sizeof(Line) == 2 * sizeof(Point), "Line must be two points");
+
 /**
  * @brief 直線 l に 点 p を射影した点を返す
  * verified with
@@ -171,8 +228,10 @@ class Line : public internal::LineBase {
  * @param p 点
  * @return Point
  */
-Point projection(const internal::LineBase &l, const Point &p) {
-    const Point a = p - l._a, b = l._b - l._a;
+template <class T>
+BasicPoint<T> projection(const internal::BasicLineBase<T> &l,
+                         const BasicPoint<T>              &p) {
+    const BasicPoint<T> a = p - l._a, b = l._b - l._a;
     return l._a + b * dot(a, b) / norm(b);
 }
 
@@ -184,8 +243,10 @@ Point projection(const internal::LineBase &l, const Point &p) {
  * @param p 点
  * @return Point
  */
-Point reflection(const internal::LineBase &l, const Point &p) {
-    Point q = projection(l, p);
+template <class T>
+BasicPoint<T> reflection(const internal::BasicLineBase<T> &l,
+                         const BasicPoint<T>              &p) {
+    BasicPoint<T> q = projection(l, p);
     return q * 2 - p;
 }
 
@@ -193,15 +254,19 @@ Point reflection(const internal::LineBase &l, const Point &p) {
  * @brief 2直線のなす角を返す。返り値は0とPI/2の間
  * @return Real
  */
-Real angle(const internal::LineBase &a, const internal::LineBase &b) {
-    static const Real HALF_OF_SQRT2 = 0.70710678;
-    Point             u = a._a - a._b, v = b._a - b._b;
-    Real              val = std::abs(dot(u, v)) / abs(u) / abs(v);
+template <class T>
+typename coordinate_traits<T>::real_type angle(
+    const internal::BasicLineBase<T> &a,
+    const internal::BasicLineBase<T> &b) {
+    using R                      = typename coordinate_traits<T>::real_type;
+    static const R HALF_OF_SQRT2 = 0.70710678;
+    BasicPoint<T>  u = a._a - a._b, v = b._a - b._b;
+    R              val = std::abs(R(dot(u, v))) / abs(u) / abs(v);
     // arccos を用いると1付近での精度が落ちるので arcsin に切り替える
     if (val < HALF_OF_SQRT2)
         return std::acos(val);
     else
-        return std::asin(std::abs(cross(u, v)) / abs(u) / abs(v));
+        return std::asin(std::abs(R(cross(u, v))) / abs(u) / abs(v));
 }
 
 /**
@@ -210,8 +275,11 @@ Real angle(const internal::LineBase &a, const internal::LineBase &b) {
  * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/2/CGL_2_A
  * @return true
  */
-bool parallel(const internal::LineBase &a, const internal::LineBase &b) {
-    return eq(cross(a._a - a._b, b._a - b._b), 0.0);
+template <class T>
+bool parallel(const internal::BasicLineBase<T> &a,
+              const internal::BasicLineBase<T> &b) {
+    auto c = cross(a._a - a._b, b._a - b._b);
+    return eq(c, decltype(c)(0));
 }
 
 /**
@@ -220,15 +288,23 @@ bool parallel(const internal::LineBase &a, const internal::LineBase &b) {
  * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/2/CGL_2_A
  * @return true
  */
-bool orthogonal(const internal::LineBase &a, const internal::LineBase &b) {
-    return eq(dot(a._a - a._b, b._a - b._b), 0.0);
+template <class T>
+bool orthogonal(const internal::BasicLineBase<T> &a,
+                const internal::BasicLineBase<T> &b) {
+    auto d = dot(a._a - a._b, b._a - b._b);
+    return eq(d, decltype(d)(0));
 }
 
-Real distance(const Line &l, const Point &p) {
-    return std::abs(cross(l._a - p, l._b - p)) / abs(l._a - l._b);
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicLine<T>  &l,
+                                                  const BasicPoint<T> &p) {
+    using R = typename coordinate_traits<T>::real_type;
+    return std::abs(R(cross(l._a - p, l._b - p))) / abs(l._a - l._b);
 }
 
-Real distance(const Point &p, const Line &l) {
+template <class T>
+typename coordinate_traits<T>::real_type distance(const BasicPoint<T> &p,
+                                                  const BasicLine<T>  &l) {
     return distance(l, p);
 }
 
@@ -0,0 +1,166 @@
+#ifndef GEOMETRY_MANHATTAN_INTERSECTION_HPP_
+#define GEOMETRY_MANHATTAN_INTERSECTION_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "segment.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+// 1点に加算し，接頭辞の和を求める Binary Indexed Tree
+class FenwickTree {
+   public:
+    explicit FenwickTree(std::size_t n) : _data(n + 1, 0) {
+    }
+
+    void add(std::size_t i, long long v) {
+        for (i++; i < _data.size(); i += i & -i) _data[i] += v;
+    }
+
+    // [0, i) の和
+    long long sum(std::size_t i) const {
+        long long ret = 0;
+        for (; i > 0; i -= i & -i) ret += _data[i];
+        return ret;
+    }
+
+   private:
+    std::vector<long long> _data;
+};
+
+/**
+ * @brief events of the sweep over axis-parallel segments.
+ * The sweep line moves from left to right. At the same x-coordinate,
+ * horizontal segments are inserted, then vertical segments are queried,
+ * and then horizontal segments are removed, so touching at endpoints
+ * counts as an intersection.
+ * Each event is (x, kind, index) with kind 0: insert, 1: query,
+ * 2: remove. A segment of length 0 is treated as vertical.
+ */
+template <class T>
+std::vector<std::tuple<T, int, std::size_t>> manhattan_events(
+    const std::vector<BasicSegment<T>> &segments) {
+    std::vector<std::tuple<T, int, std::size_t>> ret;
+    ret.reserve(2 * segments.size());
+    for (std::size_t i = 0; i < segments.size(); i++) {
+        const BasicSegment<T> &s = segments[i];
+        if (s.is_vertical()) {
+            ret.emplace_back(s.x1(), 1, i);
+        } else {
+            assert(s.is_horizontal());
+            ret.emplace_back(std::min(s.x1(), s.x2()), 0, i);
+            ret.emplace_back(std::max(s.x1(), s.x2()), 2, i);
+        }
+    }
+    std::sort(std::begin(ret), std::end(ret));
+    return ret;
+}
+
+}  // namespace internal
+
+/**
+ * @brief count the intersections among horizontal and vertical segments.
+ * verified with
+ * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/6/CGL_6_A
+ * Every segment must be horizontal or vertical. Only the pairs of a
+ * horizontal and a vertical segment are counted, and parallel segments
+ * are assumed not to overlap.
+ * The coordinates are only compared, so it takes O(n log n) time
+ * without any predicate with errors.
+ * @param segments Segment
+ * @return the number of intersecting pairs
+ */
+template <class T>
+long long count_manhattan_intersections(
+    const std::vector<BasicSegment<T>> &segments) {
+    // 水平な線分の y 座標を座標圧縮する
+    std::vector<T> ys;
+    for (const BasicSegment<T> &s : segments) {
+        if (!s.is_vertical()) ys.push_back(s.y1());
+    }
+    std::sort(std::begin(ys), std::end(ys));
+    ys.erase(std::unique(std::begin(ys), std::end(ys)), std::end(ys));
+    auto index = [&ys](T y) {
+        return std::size_t(std::lower_bound(std::begin(ys), std::end(ys), y) -
+                           std::begin(ys));
+    };
+    internal::FenwickTree bit(ys.size());
+    long long             ret = 0;
+    for (const auto &ev : internal::manhattan_events(segments)) {
+        const BasicSegment<T> &s = segments[std::get<2>(ev)];
+        switch (std::get<1>(ev)) {
+            case 0:
+                bit.add(index(s.y1()), 1);
+                break;
+            case 1: {
+                T lo = std::min(s.y1(), s.y2()), hi = std::max(s.y1(), s.y2());
+                std::size_t last = std::upper_bound(
+                                       std::begin(ys), std::end(ys), hi) -
+                                   std::begin(ys);
+                ret += bit.sum(last) - bit.sum(index(lo));
+                break;
+            }
+            default:
+                bit.add(index(s.y1()), -1);
+                break;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief enumerate the intersections among horizontal and vertical
+ * segments in O(n log n + k) time for k pairs.
+ * See count_manhattan_intersections for the conditions.
+ * @param segments Segment
+ * @param report called as report(i, j, p) with i < j for each pair,
+ * where p is the cross point.
+ */
+template <class T, class Callback>
+void manhattan_intersections(const std::vector<BasicSegment<T>> &segments,
+                             Callback                          &&report) {
+    // 走査線と交わる水平な線分の (y 座標, 番号)
+    std::set<std::pair<T, std::size_t>> active;
+    for (const auto &ev : internal::manhattan_events(segments)) {
+        const std::size_t      i = std::get<2>(ev);
+        const BasicSegment<T> &s = segments[i];
+        switch (std::get<1>(ev)) {
+            case 0:
+                active.emplace(s.y1(), i);
+                break;
+            case 1: {
+                T lo = std::min(s.y1(), s.y2()), hi = std::max(s.y1(), s.y2());
+                for (auto it = active.lower_bound({lo, 0});
+                     it != std::end(active) && it->first <= hi;
+                     ++it) {
+                    report(std::min(i, it->second),
+                           std::max(i, it->second),
+                           BasicPoint<T>(s.x1(), it->first));
+                }
+                break;
+            }
+            default:
+                active.erase({s.y1(), i});
+                break;
+        }
+    }
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_MANHATTAN_INTERSECTION_HPP_
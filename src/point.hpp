@@ -1,11 +1,17 @@
 #ifndef GEOMETRY_POINT_HPP_
 #define GEOMETRY_POINT_HPP_
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <complex>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "config.hpp"
 
@@ -13,17 +19,41 @@ namespace sapphre15 {
 
 namespace geometry {
 
+namespace internal {
+
+// a * b + c を計算する。浮動小数点数では fma で丸め誤差を抑える
+template <class T>
+T mul_add(const T &a, const T &b, const T &c) {
+    if constexpr (std::is_floating_point<T>::value)
+        return std::fma(a, b, c);
+    else
+        return a * b + c;
+}
+
+}  // namespace internal
+
 // 点を管理するクラス
-class Point {
+template <class T>
+class BasicPoint {
    public:
-    using value_type = Real;
-    constexpr Point() : _x(0), _y(0) {
+    using value_type = T;
+    // 距離や角度を表す型
+    using real_type = typename coordinate_traits<T>::real_type;
+
+    constexpr BasicPoint() : _x(0), _y(0) {
     }
 
-    constexpr Point(const value_type &xval, const value_type &yval)
+    constexpr BasicPoint(const value_type &xval, const value_type &yval)
         : _x(xval), _y(yval) {
     }
 
+    // 座標の型が異なる点からの変換
+    template <class U>
+    constexpr explicit BasicPoint(const BasicPoint<U> &p)
+        : _x(static_cast<value_type>(p.x())),
+          _y(static_cast<value_type>(p.y())) {
+    }
+
     constexpr value_type x() const {
         return _x;
     }
@@ -40,172 +70,212 @@ class Point {
         _y = std::move(val);
     }
 
-    constexpr Point &operator+=(const Point &rhs) {
+    constexpr BasicPoint &operator+=(const BasicPoint &rhs) {
         _x += rhs._x;
         _y += rhs._y;
         return *this;
     }
 
-    constexpr Point &operator-=(const Point &rhs) {
+    constexpr BasicPoint &operator-=(const BasicPoint &rhs) {
         _x -= rhs._x;
         _y -= rhs._y;
         return *this;
     }
 
-    constexpr Point &operator*=(const Point &rhs) {
+    constexpr BasicPoint &operator*=(const BasicPoint &rhs) {
         _x *= rhs._x;
         _y *= rhs._y;
         return *this;
     }
 
-    constexpr Point &operator*=(const value_type &rhs) {
+    constexpr BasicPoint &operator*=(const value_type &rhs) {
         _x *= rhs;
         _y *= rhs;
         return *this;
     }
 
-    constexpr Point &operator/=(const Point &rhs) {
+    constexpr BasicPoint &operator/=(const BasicPoint &rhs) {
         _x /= rhs._x;
         _y /= rhs._y;
         return *this;
     }
 
-    constexpr Point &operator/=(const value_type &rhs) {
+    constexpr BasicPoint &operator/=(const value_type &rhs) {
         _x /= rhs;
         _y /= rhs;
         return *this;
     }
 
-    void rotate(const Real &theta) {
-        auto tmpx = _x, tmpy = _y;
-        _x = tmpx * std::cos(theta) - tmpy * std::sin(theta);
-        _y = tmpx * std::sin(theta) + tmpy * std::cos(theta);
+    // 同じ角度で何度も回転するときは AffineTransform を使う
+    void rotate(const real_type &theta) {
+        const real_type c = std::cos(theta), s = std::sin(theta);
+        auto            tmpx = _x, tmpy = _y;
+        _x = tmpx * c - tmpy * s;
+        _y = tmpx * s + tmpy * c;
     }
 
-    Real distance(const Point &q) const {
-        return std::hypot(_x - q._x, _y - q._y);
+    real_type distance(const BasicPoint &q) const {
+        return std::hypot(real_type(_x - q._x), real_type(_y - q._y));
     }
 
-    Real distance() const {
-        return std::hypot(_x, _y);
+    real_type distance() const {
+        return std::hypot(real_type(_x), real_type(_y));
     }
 
-    Real xdist(const Point &q) const {
+    value_type xdist(const BasicPoint &q) const {
         return std::abs(_x - q._x);
     }
 
-    Real ydist(const Point &q) const {
+    value_type ydist(const BasicPoint &q) const {
         return std::abs(_y - q._y);
     }
 
-    static Point polar(const Real &theta) {
-        return Point(std::cos(theta), std::sin(theta));
+    static BasicPoint polar(const real_type &theta) {
+        return BasicPoint(std::cos(theta), std::sin(theta));
     }
 
-    static Point polar(const Real &theta, const Real &rho) {
-        return Point(rho * std::cos(theta), rho * std::sin(theta));
+    static BasicPoint polar(const real_type &theta, const real_type &rho) {
+        return BasicPoint(rho * std::cos(theta), rho * std::sin(theta));
     }
 
    private:
     value_type _x, _y;
 };
 
-Point::value_type abs(const Point &p) {
+template <class T>
+typename BasicPoint<T>::real_type abs(const BasicPoint<T> &p) {
     return p.distance();
 }
 
-Point::value_type arg(const Point &p) {
-    return std::atan2(p.y(), p.x());
+template <class T>
+typename BasicPoint<T>::real_type arg(const BasicPoint<T> &p) {
+    using R = typename BasicPoint<T>::real_type;
+    return std::atan2(R(p.y()), R(p.x()));
 }
 
-Point::value_type norm(const Point &p) {
-    return fma(p.x(), p.x(), p.y() * p.y());
+template <class T>
+typename coordinate_traits<T>::product_type norm(const BasicPoint<T> &p) {
+    using P = typename coordinate_traits<T>::product_type;
+    return internal::mul_add(P(p.x()), P(p.x()), P(p.y()) * P(p.y()));
 }
 
-constexpr Point operator+(const Point &lhs) {
+template <class T>
+constexpr BasicPoint<T> operator+(const BasicPoint<T> &lhs) {
     return lhs;
 }
 
-constexpr Point operator-(const Point &lhs) {
-    return Point(lhs) *= -1;
+template <class T>
+constexpr BasicPoint<T> operator-(const BasicPoint<T> &lhs) {
+    return BasicPoint<T>(lhs) *= -1;
 }
 
-constexpr Point operator+(const Point &lhs, const Point &rhs) {
-    return Point(lhs) += rhs;
+template <class T>
+constexpr BasicPoint<T> operator+(const BasicPoint<T> &lhs,
+                                  const BasicPoint<T> &rhs) {
+    return BasicPoint<T>(lhs) += rhs;
 }
 
-constexpr Point operator-(const Point &lhs, const Point &rhs) {
-    return Point(lhs) -= rhs;
+template <class T>
+constexpr BasicPoint<T> operator-(const BasicPoint<T> &lhs,
+                                  const BasicPoint<T> &rhs) {
+    return BasicPoint<T>(lhs) -= rhs;
 }
 
-constexpr Point operator*(const Point &lhs, const Point &rhs) {
-    return Point(lhs) *= rhs;
+template <class T>
+constexpr BasicPoint<T> operator*(const BasicPoint<T> &lhs,
+                                  const BasicPoint<T> &rhs) {
+    return BasicPoint<T>(lhs) *= rhs;
 }
 
-constexpr Point operator*(const Point &lhs, const Point::value_type &rhs) {
-    return Point(lhs) *= rhs;
+template <class T>
+constexpr BasicPoint<T> operator*(
+    const BasicPoint<T>                      &lhs,
+    const typename BasicPoint<T>::value_type &rhs) {
+    return BasicPoint<T>(lhs) *= rhs;
 }
 
-constexpr Point operator/(const Point &lhs, const Point &rhs) {
-    return Point(lhs) /= rhs;
+template <class T>
+constexpr BasicPoint<T> operator/(const BasicPoint<T> &lhs,
+                                  const BasicPoint<T> &rhs) {
+    return BasicPoint<T>(lhs) /= rhs;
 }
 
-constexpr Point operator/(const Point &lhs, const Point::value_type &rhs) {
-    return Point(lhs) /= rhs;
+template <class T>
+constexpr BasicPoint<T> operator/(
+    const BasicPoint<T>                      &lhs,
+    const typename BasicPoint<T>::value_type &rhs) {
+    return BasicPoint<T>(lhs) /= rhs;
 }
 
-bool operator==(const Point &lhs, const Point &rhs) {
+template <class T>
+bool operator==(const BasicPoint<T> &lhs, const BasicPoint<T> &rhs) {
     return eq(lhs.x(), rhs.x()) && eq(lhs.y(), rhs.y());
 }
 
-bool operator!=(const Point &lhs, const Point &rhs) {
+template <class T>
+bool operator!=(const BasicPoint<T> &lhs, const BasicPoint<T> &rhs) {
     return !(lhs == rhs);
 }
 
-std::istream &operator>>(std::istream &is, Point &p) {
-    Real a, b;
+template <class T>
+std::istream &operator>>(std::istream &is, BasicPoint<T> &p) {
+    T a, b;
     is >> a >> b;
-    p = Point(a, b);
+    p = BasicPoint<T>(a, b);
     return is;
 }
 
-std::ostream &operator<<(std::ostream &os, Point &p) {
+template <class T>
+std::ostream &operator<<(std::ostream &os, BasicPoint<T> &p) {
     return os << '(' << p.x() << ',' << p.y() << ')';
 }
 
-Point rotate(const Point &p, const Real &theta) {
-    Point ret(p);
+template <class T>
+BasicPoint<T> rotate(const BasicPoint<T>                     &p,
+                     const typename BasicPoint<T>::real_type &theta) {
+    BasicPoint<T> ret(p);
     ret.rotate(theta);
     return ret;
 }
 
-Real distance(const Point &p, const Point &q) {
+template <class T>
+typename BasicPoint<T>::real_type distance(const BasicPoint<T> &p,
+                                           const BasicPoint<T> &q) {
     return p.distance(q);
 }
 
-Real xdist(const Point &p, const Point &q) {
+template <class T>
+T xdist(const BasicPoint<T> &p, const BasicPoint<T> &q) {
     return p.xdist(q);
 }
 
-Real ydist(const Point &p, const Point &q) {
+template <class T>
+T ydist(const BasicPoint<T> &p, const BasicPoint<T> &q) {
     return p.ydist(q);
 }
 
 // ベクトル p, q の内積を計算する
-Real dot(const Point &p, const Point &q) {
-    return fma(p.x(), q.x(), p.y() * q.y());
+template <class T>
+typename coordinate_traits<T>::product_type dot(const BasicPoint<T> &p,
+                                                const BasicPoint<T> &q) {
+    using P = typename coordinate_traits<T>::product_type;
+    return internal::mul_add(P(p.x()), P(q.x()), P(p.y()) * P(q.y()));
 }
 
 // ベクトル p, q の外積を計算する
-Real cross(const Point &p, const Point &q) {
-    return fma(p.x(), q.y(), -p.y() * q.x());
+template <class T>
+typename coordinate_traits<T>::product_type cross(const BasicPoint<T> &p,
+                                                  const BasicPoint<T> &q) {
+    using P = typename coordinate_traits<T>::product_type;
+    return internal::mul_add(P(p.x()), P(q.y()), -P(p.y()) * P(q.x()));
 }
 
 // 点 p と点 q を a : b に内分する点
-Point internal_div(const Point &p,
-                   const Point &q,
-                   const Real  &a,
-                   const Real  &b) {
+template <class T>
+BasicPoint<T> internal_div(const BasicPoint<T>                      &p,
+                           const BasicPoint<T>                      &q,
+                           const typename BasicPoint<T>::value_type &a,
+                           const typename BasicPoint<T>::value_type &b) {
     assert(0 <= a);
     assert(0 <= b);
     assert(0 <= a + b);
@@ -213,83 +283,332 @@ Point internal_div(const Point &p,
 }
 
 // 点 p と点 q の中点
-Point mid_point(const Point &p, const Point &q) {
+template <class T>
+BasicPoint<T> mid_point(const BasicPoint<T> &p, const BasicPoint<T> &q) {
     return internal_div(p, q, 1.0, 1.0);
 }
 
 // 点 p と点 q を a : b に外分する点
-Point external_div(const Point &p,
-                   const Point &q,
-                   const Real  &a,
-                   const Real  &b) {
+template <class T>
+BasicPoint<T> external_div(const BasicPoint<T>                      &p,
+                           const BasicPoint<T>                      &q,
+                           const typename BasicPoint<T>::value_type &a,
+                           const typename BasicPoint<T>::value_type &b) {
     assert(0 <= a);
     assert(0 <= b);
     assert(!eq(a, b));
     return (q * a - p * b) / (a - b);
 }
 
-Real co_circle_internal1(Point p, Point q, Point r, const Point &s) {
+namespace internal {
+
+// 座標の4次式を計算する型。整数座標では __int128 を使う
+template <class T, class = void>
+struct quartic_type {
+    using type = typename coordinate_traits<T>::product_type;
+};
+#ifdef __SIZEOF_INT128__
+template <class T>
+struct quartic_type<T, std::enable_if_t<is_integer<T>::value>> {
+    using type = int128_t;
+};
+#endif
+
+}  // namespace internal
+
+/**
+ * 整数座標では |座標| < 2^30 の範囲で符号が厳密になる。
+ * 各項は 2^126 未満なので，溢れうるのは最後の加算だけであり，そのときは
+ * 符号の正しい値として最後の項を返す。
+ */
+template <class T>
+typename internal::quartic_type<T>::type co_circle_internal1(
+    BasicPoint<T>        p,
+    BasicPoint<T>        q,
+    BasicPoint<T>        r,
+    const BasicPoint<T> &s) {
+    using Q = typename internal::quartic_type<T>::type;
     p -= s;
     q -= s;
     r -= s;
-    return cross(p, q) * norm(r) + cross(q, r) * norm(p) +
-           cross(r, p) * norm(q);
+    if constexpr (coordinate_traits<T>::is_exact && sizeof(Q) >= 16) {
+        if constexpr (sizeof(T) > 4) {
+            [[maybe_unused]] const T b = T(1) << 31;
+            assert(-b < p.x() && p.x() < b && -b < p.y() && p.y() < b);
+            assert(-b < q.x() && q.x() < b && -b < q.y() && q.y() < b);
+            assert(-b < r.x() && r.x() < b && -b < r.y() && r.y() < b);
+        }
+        Q a = Q(cross(p, q)) * Q(norm(r)), b = Q(cross(q, r)) * Q(norm(p)),
+          c = Q(cross(r, p)) * Q(norm(q)), ret;
+        if (__builtin_add_overflow(a + b, c, &ret)) return c;
+        return ret;
+    } else {
+        return cross(p, q) * norm(r) + cross(q, r) * norm(p) +
+               cross(r, p) * norm(q);
+    }
 }
 
-Real co_circle_internal2(Point p, Point q, Point r, const Point &s) {
+template <class T>
+typename coordinate_traits<T>::product_type co_circle_internal2(
+    BasicPoint<T>        p,
+    BasicPoint<T>        q,
+    BasicPoint<T>        r,
+    const BasicPoint<T> &s) {
     p -= s;
     q -= s;
     r -= s;
     return cross(p, q) + cross(q, r) + cross(r, p);
 }
 
+enum ClockWise {
+    ONLINE_FRONT      = -2,
+    CLOCKWISE         = -1,
+    ON_SEGMENT        = 0,
+    COUNTER_CLOCKWISE = +1,
+    ONLINE_BACK       = +2,
+};
+
+/**
+ * @brief 誤差定数 EPS を用いて判定する述語
+ * ccw, in_circle, on_circle, out_circle, equal の既定の判定方法。
+ * 誤差に強い判定が必要な場合は robust_predicate.hpp の ExactPredicate を
+ * テンプレート引数に与える。
+ */
+struct EpsilonPredicate {
+    template <class T>
+    static ClockWise ccw(const BasicPoint<T> &a,
+                         BasicPoint<T>        b,
+                         BasicPoint<T>        c) {
+        b -= a, c -= a;
+        if (sgn(cross(b, c)) > 0) return COUNTER_CLOCKWISE;
+        if (sgn(cross(b, c)) < 0) return CLOCKWISE;
+        if (sgn(dot(b, c)) < 0) return ONLINE_BACK;
+        if constexpr (coordinate_traits<T>::is_exact) {
+            if (norm(c) <= norm(b)) return ON_SEGMENT;
+        } else {
+            if (le(abs(c), abs(b))) return ON_SEGMENT;
+        }
+        return ONLINE_FRONT;
+    }
+
+    template <class T>
+    static bool in_circle(const BasicPoint<T> &p,
+                          const BasicPoint<T> &q,
+                          const BasicPoint<T> &r,
+                          const BasicPoint<T> &s) {
+        return sgn(co_circle_internal1(p, q, r, s)) ==
+               sgn(co_circle_internal2(p, q, r, s));
+    }
+
+    template <class T>
+    static bool on_circle(const BasicPoint<T> &p,
+                          const BasicPoint<T> &q,
+                          const BasicPoint<T> &r,
+                          const BasicPoint<T> &s) {
+        using Q = typename internal::quartic_type<T>::type;
+        return eq(co_circle_internal1(p, q, r, s), Q(0));
+    }
+
+    template <class T>
+    static bool out_circle(const BasicPoint<T> &p,
+                           const BasicPoint<T> &q,
+                           const BasicPoint<T> &r,
+                           const BasicPoint<T> &s) {
+        return sgn(co_circle_internal1(p, q, r, s)) ==
+               sgn(co_circle_internal2(p, q, r, s)) * -1;
+    }
+
+    // 同じ点とみなすか
+    template <class T>
+    static bool equal(const BasicPoint<T> &a, const BasicPoint<T> &b) {
+        return a == b;
+    }
+};
+
 // 3点 p, q, r を含むような最小の円は点 s を内部に含むか（境界を含まない）
-bool in_circle(const Point &p, const Point &q, const Point &r, const Point &s) {
-    return sgn(co_circle_internal1(p, q, r, s)) ==
-           sgn(co_circle_internal2(p, q, r, s));
+template <class Predicate = EpsilonPredicate, class T>
+bool in_circle(const BasicPoint<T> &p,
+               const BasicPoint<T> &q,
+               const BasicPoint<T> &r,
+               const BasicPoint<T> &s) {
+    return Predicate::in_circle(p, q, r, s);
 }
 
 // 3点 p, q, r を含むような最小の円は点 s を円周上に含むか
-bool on_circle(const Point &p, const Point &q, const Point &r, const Point &s) {
-    return eq(co_circle_internal1(p, q, r, s), 0);
+template <class Predicate = EpsilonPredicate, class T>
+bool on_circle(const BasicPoint<T> &p,
+               const BasicPoint<T> &q,
+               const BasicPoint<T> &r,
+               const BasicPoint<T> &s) {
+    return Predicate::on_circle(p, q, r, s);
 }
 
 // 3点 p, q, r を含むような最小の円の外部に点 s は位置するか
-bool out_circle(const Point &p,
-                const Point &q,
-                const Point &r,
-                const Point &s) {
-    return sgn(co_circle_internal1(p, q, r, s)) ==
-           sgn(co_circle_internal2(p, q, r, s)) * -1;
+template <class Predicate = EpsilonPredicate, class T>
+bool out_circle(const BasicPoint<T> &p,
+                const BasicPoint<T> &q,
+                const BasicPoint<T> &r,
+                const BasicPoint<T> &s) {
+    return Predicate::out_circle(p, q, r, s);
 }
 
-enum ClockWise {
-    ONLINE_FRONT      = -2,
-    CLOCKWISE         = -1,
-    ON_SEGMENT        = 0,
-    COUNTER_CLOCKWISE = +1,
-    ONLINE_BACK       = +2,
-};
-
 /**
  * @brief 点a, b, c がどのように並んでいるかを判定する
  * verified with https://onlinejudge.u-aizu.ac.jp/problems/CGL_1_C
  */
-ClockWise ccw(const Point &a, Point b, Point c) {
-    b -= a, c -= a;
-    if (sgn(cross(b, c)) > 0) return COUNTER_CLOCKWISE;
-    if (sgn(cross(b, c)) < 0) return CLOCKWISE;
-    if (sgn(dot(b, c)) < 0) return ONLINE_BACK;
-    if (le(abs(c), abs(b))) return ON_SEGMENT;
-    return ONLINE_FRONT;
+template <class Predicate = EpsilonPredicate, class T>
+ClockWise ccw(const BasicPoint<T> &a,
+              const BasicPoint<T> &b,
+              const BasicPoint<T> &c) {
+    return Predicate::ccw(a, b, c);
 }
 
 // 3点 p, q, r が一直線上にあるか
-bool colinear(const Point &p, const Point &q, const Point &r) {
-    ClockWise state = ccw(p, q, r);
+template <class Predicate = EpsilonPredicate, class T>
+bool colinear(const BasicPoint<T> &p,
+              const BasicPoint<T> &q,
+              const BasicPoint<T> &r) {
+    ClockWise state = ccw<Predicate>(p, q, r);
     return state != COUNTER_CLOCKWISE && state != CLOCKWISE;
 }
 
+namespace internal {
+
+// 実数で求めた点を座標の型 T に直す。整数座標では最も近い整数に丸める
+template <class T, class R>
+BasicPoint<T> round_point(const BasicPoint<R> &p) {
+    if constexpr (coordinate_traits<T>::is_exact) {
+        return BasicPoint<T>(T(std::llround(p.x())), T(std::llround(p.y())));
+    } else {
+        return BasicPoint<T>(p);
+    }
+}
+
+/**
+ * @brief the exact sign of cross(p, q).
+ * For floating-point coordinates, each product is split into its rounded
+ * value and the rounding error by fma, and the sign of the difference of
+ * the two pairs is taken from an exact expansion (Shewchuk's
+ * Two_Two_Diff). A fast filter skips this when the rounded difference
+ * is clearly away from zero.
+ */
+template <class T>
+int cross_sign(const BasicPoint<T> &p, const BasicPoint<T> &q) {
+    if constexpr (coordinate_traits<T>::is_exact) {
+        return sgn(cross(p, q));
+    } else {
+        const T a = p.x() * q.y(), da = std::fma(p.x(), q.y(), -a);
+        const T b = p.y() * q.x(), db = std::fma(p.y(), q.x(), -b);
+        const T d = a - b;
+        if (std::abs(d) > 4 * std::numeric_limits<T>::epsilon() *
+                              (std::abs(a) + std::abs(b))) {
+            return d > 0 ? 1 : -1;
+        }
+        // x + y == s + t を厳密に満たす x = fl(s + t) と y
+        auto two_sum = [](T s, T t, T &x, T &y) {
+            x      = s + t;
+            T tvir = x - s, svir = x - tvir;
+            y      = (s - svir) + (t - tvir);
+        };
+        // (a + da) - (b + db) を重なりのない4項 e[0] < ... < e[3] で表す
+        T e[4], i, j, k;
+        two_sum(da, -db, i, e[0]);
+        two_sum(a, i, j, k);
+        two_sum(k, -b, i, e[1]);
+        two_sum(j, i, e[3], e[2]);
+        for (int m = 3; m >= 0; m--) {
+            if (e[m] != 0) return e[m] > 0 ? 1 : -1;
+        }
+        return 0;
+    }
+}
+
+// この個数未満の点は std::sort だけで並べる
+constexpr std::size_t SORT_BY_ANGLE_MIN = 64;
+
+// 原点なら 0, 偏角が [0, pi) なら 1, [pi, 2pi) なら 2
+template <class T>
+int angle_half(const BasicPoint<T> &p) {
+    if (p.x() == 0 && p.y() == 0) return 0;
+    return p.y() < 0 || (p.y() == 0 && p.x() < 0) ? 2 : 1;
+}
+
+// 偏角について単調な [0, 4) の値。三角関数を使わずに求まる
+template <class T>
+typename coordinate_traits<T>::real_type pseudo_angle(const BasicPoint<T> &p) {
+    using R = typename coordinate_traits<T>::real_type;
+    R x = p.x(), y = p.y(), d = std::abs(x) + std::abs(y);
+    if (d == 0) return 0;
+    R t = 1 - x / d;
+    return y < 0 || (y == 0 && x < 0) ? 4 - t : t;
+}
+
+}  // namespace internal
+
+/**
+ * @brief compare the points by the argument in [0, 2pi).
+ * It uses only the signs of the coordinates and of the cross product,
+ * so it calls no atan2 and has no tolerance EPS. The sign of the cross
+ * product is exact also for floating-point coordinates, so this is a
+ * strict weak ordering for any input. The origin is less than any other
+ * point, and points with the same argument are equivalent.
+ */
+template <class T>
+bool angle_less(const BasicPoint<T> &a, const BasicPoint<T> &b) {
+    int ha = internal::angle_half(a), hb = internal::angle_half(b);
+    if (ha != hb) return ha < hb;
+    return internal::cross_sign(a, b) > 0;
+}
+
+/**
+ * @brief sort the points by the argument around origin in [0, 2pi).
+ * The points are first distributed into about n buckets by a monotone
+ * pseudo-angle computed without trigonometric functions. The buckets
+ * are sorted by angle_less, and an insertion sort by angle_less fixes
+ * the points that the rounding of the pseudo-angle put into a wrong
+ * bucket. The result is the same as std::sort with angle_less.
+ * The vectors p - origin are computed in T before the comparison, so for
+ * floating-point coordinates the order is exact for the rounded vectors.
+ * @param first, last random access iterators to Point
+ * @param origin Point
+ */
+template <class RandomIt, class T>
+void sort_by_angle(RandomIt first, RandomIt last, const BasicPoint<T> &origin) {
+    using R             = typename coordinate_traits<T>::real_type;
+    const std::size_t n = std::distance(first, last);
+    auto less = [&origin](const BasicPoint<T> &a, const BasicPoint<T> &b) {
+        return angle_less(a - origin, b - origin);
+    };
+    if (n < internal::SORT_BY_ANGLE_MIN) {
+        std::sort(first, last, less);
+        return;
+    }
+    // 疑似偏角でバケットに分ける
+    std::vector<std::size_t>   bucket(n), start(n + 1, 0);
+    std::vector<BasicPoint<T>> buf(first, last);
+    for (std::size_t i = 0; i < n; i++) {
+        R key     = internal::pseudo_angle(buf[i] - origin);
+        bucket[i] = std::min(n - 1, std::size_t(key * R(n) / 4));
+        start[bucket[i] + 1]++;
+    }
+    for (std::size_t b = 0; b < n; b++) start[b + 1] += start[b];
+    std::vector<std::size_t> next(std::begin(start), std::end(start) - 1);
+    for (std::size_t i = 0; i < n; i++) first[next[bucket[i]]++] = buf[i];
+    for (std::size_t b = 0; b < n; b++) {
+        if (start[b + 1] - start[b] > 1) {
+            std::sort(first + start[b], first + start[b + 1], less);
+        }
+    }
+    // 丸め誤差で隣のバケットに入った点を正しい位置に動かす
+    for (std::size_t i = 1; i < n; i++) {
+        if (!less(first[i], first[i - 1])) continue;
+        BasicPoint<T> p = first[i];
+        std::size_t   j = i;
+        for (; j > 0 && less(p, first[j - 1]); j--) first[j] = first[j - 1];
+        first[j] = p;
+    }
+}
+
 }  // namespace geometry
 
 }  // namespace sapphre15
@@ -0,0 +1,281 @@
+#ifndef GEOMETRY_POINT_BUFFER_HPP_
+#define GEOMETRY_POINT_BUFFER_HPP_
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief 点の集合を x 座標の配列と y 座標の配列に分けて管理するクラス
+ * 各座標が連続したメモリに並ぶので，下の一括処理関数はコンパイラによる
+ * 自動ベクトル化が効く形になっている。
+ */
+template <class T>
+class BasicPointBuffer {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+    using point_type = BasicPoint<T>;
+
+    BasicPointBuffer() : _x(), _y() {
+    }
+    // n 個の原点からなる集合
+    explicit BasicPointBuffer(size_type n) : _x(n), _y(n) {
+    }
+    // 点の列から構築する
+    BasicPointBuffer(const std::vector<point_type> &points)
+        : BasicPointBuffer() {
+        assign(std::begin(points), std::end(points));
+    }
+
+    BasicPointBuffer(std::initializer_list<point_type> init)
+        : BasicPointBuffer() {
+        assign(std::begin(init), std::end(init));
+    }
+
+    template <class InputIterator>
+    void assign(InputIterator first, InputIterator last) {
+        clear();
+        for (; first != last; ++first) push_back(*first);
+    }
+
+    size_type size() const noexcept {
+        return _x.size();
+    }
+
+    bool empty() const noexcept {
+        return _x.empty();
+    }
+
+    void reserve(size_type n) {
+        _x.reserve(n);
+        _y.reserve(n);
+    }
+
+    void resize(size_type n) {
+        _x.resize(n);
+        _y.resize(n);
+    }
+
+    void clear() noexcept {
+        _x.clear();
+        _y.clear();
+    }
+
+    void push_back(const point_type &p) {
+        _x.push_back(p.x());
+        _y.push_back(p.y());
+    }
+
+    // n 番目の点
+    point_type operator[](size_type n) const {
+        assert(n < size());
+        return point_type(_x[n], _y[n]);
+    }
+
+    // n 番目の点を p に置き換える
+    void set(size_type n, const point_type &p) {
+        assert(n < size());
+        _x[n] = p.x();
+        _y[n] = p.y();
+    }
+
+    // x 座標の配列の先頭
+    const value_type *x_data() const noexcept {
+        return _x.data();
+    }
+
+    value_type *x_data() noexcept {
+        return _x.data();
+    }
+
+    // y 座標の配列の先頭
+    const value_type *y_data() const noexcept {
+        return _y.data();
+    }
+
+    value_type *y_data() noexcept {
+        return _y.data();
+    }
+
+    // Point の配列に変換する
+    std::vector<point_type> to_points() const {
+        std::vector<point_type> ret;
+        ret.reserve(size());
+        for (size_type i = 0; i < size(); i++) ret.emplace_back(_x[i], _y[i]);
+        return ret;
+    }
+
+   private:
+    std::vector<value_type> _x, _y;
+};
+
+using PointBuffer = BasicPointBuffer<Real>;
+
+// out[i] = dot(p[i], q[i])
+template <class T>
+void dot(const BasicPointBuffer<T> &p, const BasicPointBuffer<T> &q, T *out) {
+    assert(p.size() == q.size());
+    const T *px = p.x_data(), *py = p.y_data(), *qx = q.x_data(),
+            *qy = q.y_data();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = internal::mul_add(px[i], qx[i], py[i] * qy[i]);
+    }
+}
+
+// out[i] = dot(p[i], q)
+template <class T>
+void dot(const BasicPointBuffer<T> &p, const BasicPoint<T> &q, T *out) {
+    const T *px = p.x_data(), *py = p.y_data(), qx = q.x(), qy = q.y();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = internal::mul_add(px[i], qx, py[i] * qy);
+    }
+}
+
+// out[i] = cross(p[i], q[i])
+template <class T>
+void cross(const BasicPointBuffer<T> &p,
+           const BasicPointBuffer<T> &q,
+           T                         *out) {
+    assert(p.size() == q.size());
+    const T *px = p.x_data(), *py = p.y_data(), *qx = q.x_data(),
+            *qy = q.y_data();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = internal::mul_add(px[i], qy[i], -py[i] * qx[i]);
+    }
+}
+
+// out[i] = cross(p[i], q)
+template <class T>
+void cross(const BasicPointBuffer<T> &p, const BasicPoint<T> &q, T *out) {
+    const T *px = p.x_data(), *py = p.y_data(), qx = q.x(), qy = q.y();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = internal::mul_add(px[i], qy, -py[i] * qx);
+    }
+}
+
+// out[i] = norm(p[i])
+template <class T>
+void norm(const BasicPointBuffer<T> &p, T *out) {
+    const T *px = p.x_data(), *py = p.y_data();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = internal::mul_add(px[i], px[i], py[i] * py[i]);
+    }
+}
+
+// out[i] = distance(p[i], q[i])
+template <class T>
+void distance(const BasicPointBuffer<T>                &p,
+              const BasicPointBuffer<T>                &q,
+              typename coordinate_traits<T>::real_type *out) {
+    using R = typename coordinate_traits<T>::real_type;
+    assert(p.size() == q.size());
+    const T *px = p.x_data(), *py = p.y_data(), *qx = q.x_data(),
+            *qy = q.y_data();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = std::hypot(R(px[i] - qx[i]), R(py[i] - qy[i]));
+    }
+}
+
+// out[i] = distance(p[i], q)
+template <class T>
+void distance(const BasicPointBuffer<T>                &p,
+              const BasicPoint<T>                      &q,
+              typename coordinate_traits<T>::real_type *out) {
+    using R     = typename coordinate_traits<T>::real_type;
+    const T *px = p.x_data(), *py = p.y_data(), qx = q.x(), qy = q.y();
+    for (size_t i = 0; i < p.size(); i++) {
+        out[i] = std::hypot(R(px[i] - qx), R(py[i] - qy));
+    }
+}
+
+// out[i] = ccw(a, b, c[i])
+template <class Predicate = EpsilonPredicate, class T>
+void ccw(const BasicPoint<T>       &a,
+         const BasicPoint<T>       &b,
+         const BasicPointBuffer<T> &c,
+         ClockWise                 *out) {
+    const T *cx = c.x_data(), *cy = c.y_data();
+    for (size_t i = 0; i < c.size(); i++) {
+        out[i] = ccw<Predicate>(a, b, BasicPoint<T>(cx[i], cy[i]));
+    }
+}
+
+template <class T>
+std::vector<T> dot(const BasicPointBuffer<T> &p,
+                   const BasicPointBuffer<T> &q) {
+    std::vector<T> ret(p.size());
+    dot(p, q, ret.data());
+    return ret;
+}
+
+template <class T>
+std::vector<T> dot(const BasicPointBuffer<T> &p, const BasicPoint<T> &q) {
+    std::vector<T> ret(p.size());
+    dot(p, q, ret.data());
+    return ret;
+}
+
+template <class T>
+std::vector<T> cross(const BasicPointBuffer<T> &p,
+                     const BasicPointBuffer<T> &q) {
+    std::vector<T> ret(p.size());
+    cross(p, q, ret.data());
+    return ret;
+}
+
+template <class T>
+std::vector<T> cross(const BasicPointBuffer<T> &p, const BasicPoint<T> &q) {
+    std::vector<T> ret(p.size());
+    cross(p, q, ret.data());
+    return ret;
+}
+
+template <class T>
+std::vector<T> norm(const BasicPointBuffer<T> &p) {
+    std::vector<T> ret(p.size());
+    norm(p, ret.data());
+    return ret;
+}
+
+template <class T>
+std::vector<typename coordinate_traits<T>::real_type> distance(
+    const BasicPointBuffer<T> &p,
+    const BasicPointBuffer<T> &q) {
+    std::vector<typename coordinate_traits<T>::real_type> ret(p.size());
+    distance(p, q, ret.data());
+    return ret;
+}
+
+template <class T>
+std::vector<typename coordinate_traits<T>::real_type> distance(
+    const BasicPointBuffer<T> &p,
+    const BasicPoint<T>       &q) {
+    std::vector<typename coordinate_traits<T>::real_type> ret(p.size());
+    distance(p, q, ret.data());
+    return ret;
+}
+
+template <class Predicate = EpsilonPredicate, class T>
+std::vector<ClockWise> ccw(const BasicPoint<T>       &a,
+                           const BasicPoint<T>       &b,
+                           const BasicPointBuffer<T> &c) {
+    std::vector<ClockWise> ret(c.size());
+    ccw<Predicate>(a, b, c, ret.data());
+    return ret;
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_POINT_BUFFER_HPP_
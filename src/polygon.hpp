@@ -5,6 +5,10 @@
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <set>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "config.hpp"
@@ -16,29 +20,48 @@ namespace sapphre15 {
 
 namespace geometry {
 
-class PolygonIterator;
+/**
+ * @brief where a point is located relative to a polygon.
+ * The values follow AOJ CGL_3_C.
+ */
+enum class PointLocation {
+    OUTSIDE     = 0,
+    ON_BOUNDARY = 1,
+    INSIDE      = 2,
+};
+
+template <class T>
+class BasicPolygonIterator;
 
-class Polygon {
+template <class T>
+class BasicPolygon {
    public:
+    using value_type   = T;
+    using real_type    = typename coordinate_traits<T>::real_type;
+    using point_type   = BasicPoint<T>;
+    using product_type = typename coordinate_traits<T>::product_type;
+
     /**
      * @brief Create a Polygon object whose vertex is
      * the points contained point_list.
      * The order is modified if the order is clockwise.
      * @param points_list
      */
-    Polygon(const std::vector<Point>& points_list) : _num(points_list.size()) {
+    BasicPolygon(const std::vector<point_type>& points_list)
+        : _num(points_list.size()) {
         assert(3 <= _num);
-        _points.reset(new Point[_num]);
+        _points.reset(new point_type[_num]);
         std::copy(
             std::begin(points_list), std::end(points_list), _points.get());
         // the order is checked.
-        if (sgn(area()) < 0) {
+        if (sgn(area2()) < 0) {
             std::reverse(_points.get(), _points.get() + _num);
         }
     }
 
-    Polygon(std::initializer_list<Point> init)
-        : Polygon(std::vector<Point>(std::begin(init), std::end(init))) {
+    BasicPolygon(std::initializer_list<point_type> init)
+        : BasicPolygon(
+              std::vector<point_type>(std::begin(init), std::end(init))) {
     }
 
     /**
@@ -47,12 +70,21 @@ class Polygon {
      * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/3/CGL_3_A
      * @return Real
      */
-    Real area() const {
-        Real val = cross(_points[_num - 1], _points[0]);
+    real_type area() const {
+        return real_type(area2()) / real_type(2.0);
+    }
+
+    /**
+     * @brief calculate twice the signed area of the polygon.
+     * Exact for integer coordinates.
+     * @return product_type
+     */
+    product_type area2() const {
+        product_type val = cross(_points[_num - 1], _points[0]);
         for (size_t i = 0; i < _num - 1; i++) {
             val += cross(_points[i], _points[i + 1]);
         }
-        return val / 2.0;
+        return val;
     }
 
     /**
@@ -62,9 +94,9 @@ class Polygon {
      * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/3/CGL_3_C
      * @param p Point
      */
-    bool inside(const Point& p) {
-        bool  ret = false;
-        Point _a, _b = _points[_num - 1];
+    bool inside(const point_type& p) const {
+        bool       ret = false;
+        point_type _a, _b = _points[_num - 1];
         for (size_t i = 0; i < _num; i++) {
             _a = std::move(_b);
             _b = _points[i];
@@ -81,7 +113,7 @@ class Polygon {
      * @brief Check if the point is on edges of the polygon.
      * @param p
      */
-    bool on_object(const Point& p) {
+    bool on_object(const point_type& p) const {
         for (size_t i = 1; i < _num; i++) {
             if (ccw(_points[i - 1], _points[i], p) == ON_SEGMENT) {
                 return true;
@@ -93,32 +125,34 @@ class Polygon {
      * @brief Check if the point is outside the polygon.
      * @param p Point
      */
-    bool outside(const Point& p) {
+    bool outside(const point_type& p) const {
         return !inside(p);
     }
     /**
-     * @brief Check if the point is simple.
-     * @param p Point
+     * @brief Check if the polygon is simple.
+     * It takes O(n log n) time. See self_intersection.
      */
-    bool is_simple() {
-        Point ip = _points[_num - 1];
-        for (size_t i = 0; i < _num; i++) {
-            for (size_t j = i + 1; j < (i == 0 ? _num - 2 : _num - 1); j++) {
-                if (intersection(Segment(_points[i], ip),
-                                 Segment(_points[j], _points[j + 1]))) {
-                    return false;
-                }
-            }
-            ip = _points[i];
-        }
-        return true;
+    bool is_simple() const {
+        return !self_intersection();
+    }
+    /**
+     * @brief Find a pair of non-adjacent edges that intersect.
+     * The i-th edge connects the i-th and (i+1)-th vertexes.
+     * Small polygons are checked by brute force, and larger ones by the
+     * Shamos-Hoey sweep line algorithm in O(n log n) time.
+     * @return the indices (i, j) of the edges with i < j,
+     * or std::nullopt if the polygon is simple.
+     */
+    std::optional<std::pair<size_t, size_t>> self_intersection() const {
+        if (_num < SWEEP_THRESHOLD) return brute_force();
+        return sweep();
     }
     /**
      * @brief Check if the polygon is convex.
      * veryfied with
      * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/3/CGL_3_B
      */
-    bool is_convex() {
+    bool is_convex() const {
         if (ccw(_points[_num - 1], _points[0], _points[1]) == CLOCKWISE)
             return false;
         if (ccw(_points[_num - 2], _points[_num - 1], _points[0]) == CLOCKWISE)
@@ -130,7 +164,7 @@ class Polygon {
         return true;
     }
 
-    const Point& operator[](size_t _n) const {
+    const point_type& operator[](size_t _n) const {
         assert(_n < _num);
         return _points[_n];
     }
@@ -139,27 +173,137 @@ class Polygon {
         return _num;
     }
 
-    PolygonIterator begin() const;
+    BasicPolygonIterator<T> begin() const;
 
-    PolygonIterator end() const;
+    BasicPolygonIterator<T> end() const;
 
-    friend PolygonIterator;
+    friend BasicPolygonIterator<T>;
 
    private:
+    using edge_pair = std::optional<std::pair<size_t, size_t>>;
+
+    // below this number of vertexes, self_intersection uses brute force
+    static constexpr size_t SWEEP_THRESHOLD = 32;
+
+    bool adjacent(size_t i, size_t j) const {
+        return (i + 1) % _num == j || (j + 1) % _num == i;
+    }
+
+    // test the i-th and j-th edges, which must not be adjacent
+    edge_pair check(size_t i, size_t j) const {
+        if (adjacent(i, j) ||
+            !intersection(BasicSegment<T>(_points[i], _points[(i + 1) % _num]),
+                          BasicSegment<T>(_points[j], _points[(j + 1) % _num])))
+            return std::nullopt;
+        return std::make_pair(std::min(i, j), std::max(i, j));
+    }
+
+    edge_pair brute_force() const {
+        for (size_t i = 0; i < _num; i++) {
+            for (size_t j = i + 2; j < _num; j++) {
+                if (auto res = check(i, j)) return res;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Shamos-Hoey algorithm.
+     * Sweep the edges from left to right keeping the edges on the sweep
+     * line sorted from bottom to top. Only the edges that become
+     * neighbors are tested, since the leftmost intersection is always
+     * between such edges. The edges of the same vertex touch each other,
+     * so the test goes on beyond them.
+     */
+    edge_pair sweep() const {
+        // 各辺の端点を (x, y) の辞書順に並べる
+        std::vector<std::pair<point_type, point_type>> edge(_num);
+        for (size_t i = 0; i < _num; i++) {
+            const point_type& a = _points[i];
+            const point_type& b = _points[(i + 1) % _num];
+            if (b.x() < a.x() || (b.x() == a.x() && b.y() < a.y()))
+                edge[i] = {b, a};
+            else
+                edge[i] = {a, b};
+        }
+        // 辺 i が辺 j より下にあるか
+        auto below = [&edge](size_t i, size_t j) {
+            if (i == j) return false;
+            const auto& a       = edge[i];
+            const auto& b       = edge[j];
+            bool        a_first = a.first.x() != b.first.x()
+                                      ? a.first.x() < b.first.x()
+                                      : a.first.y() < b.first.y();
+            const auto& s = a_first ? a : b;
+            const auto& t = a_first ? b : a;
+            ClockWise   c = ccw(s.first, s.second, t.first);
+            if (c != CLOCKWISE && c != COUNTER_CLOCKWISE)
+                c = ccw(s.first, s.second, t.second);
+            if (c == COUNTER_CLOCKWISE) return a_first;
+            if (c == CLOCKWISE) return !a_first;
+            return i < j;
+        };
+        using status_type = std::set<size_t, decltype(below)>;
+        status_type status(below);
+        // (x, y, 0: 挿入 / 1: 削除, 辺)
+        std::vector<std::tuple<T, T, int, size_t>> events;
+        events.reserve(2 * _num);
+        for (size_t i = 0; i < _num; i++) {
+            events.emplace_back(edge[i].first.x(), edge[i].first.y(), 0, i);
+            events.emplace_back(edge[i].second.x(), edge[i].second.y(), 1, i);
+        }
+        std::sort(std::begin(events), std::end(events));
+        // 辺 e と，it から上 (下) にある辺を隣接しない辺まで調べる
+        auto test_up = [&](size_t e, typename status_type::iterator it) {
+            for (; it != std::end(status); ++it) {
+                if (auto res = check(e, *it)) return res;
+                if (!adjacent(e, *it)) break;
+            }
+            return edge_pair();
+        };
+        auto test_down = [&](size_t e, typename status_type::iterator it) {
+            while (it != std::begin(status)) {
+                --it;
+                if (auto res = check(e, *it)) return res;
+                if (!adjacent(e, *it)) break;
+            }
+            return edge_pair();
+        };
+        for (const auto& ev : events) {
+            const size_t e = std::get<3>(ev);
+            if (std::get<2>(ev) == 0) {
+                auto it = status.insert(e).first;
+                if (auto res = test_up(e, std::next(it))) return res;
+                if (auto res = test_down(e, it)) return res;
+            } else {
+                auto it = status.find(e);
+                // 誤差で順序が崩れたときは総当たりに切り替える
+                if (it == std::end(status)) return brute_force();
+                auto next = status.erase(it);
+                if (next == std::begin(status) || next == std::end(status))
+                    continue;
+                if (auto res = test_down(*next, next)) return res;
+                if (auto res = test_up(*std::prev(next), next)) return res;
+            }
+        }
+        return std::nullopt;
+    }
+
     // number of vertex
     const size_t _num;
     // list of vertexes
     // the order is counter-clockwise
-    std::shared_ptr<Point[]> _points;
+    std::shared_ptr<point_type[]> _points;
 };
 
-class PolygonIterator {
+template <class T>
+class BasicPolygonIterator {
    public:
     using size_type         = std::size_t;
     using diff_type         = std::ptrdiff_t;
-    using value_type        = Point;
-    using refernce          = Point&;
-    using pointer           = std::shared_ptr<Point[]>;
+    using value_type        = BasicPoint<T>;
+    using refernce          = BasicPoint<T>&;
+    using pointer           = std::shared_ptr<BasicPoint<T>[]>;
     using iterator_category = std::random_access_iterator_tag;
 
     refernce operator*() {
@@ -170,33 +314,33 @@ class PolygonIterator {
         return _ptr[_idx];
     }
 
-    PolygonIterator& operator++() {
+    BasicPolygonIterator& operator++() {
         ++_idx;
         if (_idx == _length) _idx = 0;
         assert(check_idx());
         return *this;
     }
 
-    PolygonIterator operator++(int) {
+    BasicPolygonIterator operator++(int) {
         auto ret = *this;
         ++*this;
         return ret;
     }
 
-    PolygonIterator& operator--() {
+    BasicPolygonIterator& operator--() {
         if (_idx == 0) _idx = _length;
         --_idx;
         assert(check_idx());
         return *this;
     }
 
-    PolygonIterator operator--(int) {
+    BasicPolygonIterator operator--(int) {
         auto ret = *this;
         --*this;
         return ret;
     }
 
-    PolygonIterator& operator+=(diff_type _n) {
+    BasicPolygonIterator& operator+=(diff_type _n) {
         if (_n < 0) _n = _n % _length + _length;
         _idx += _n;
         if (_length <= _idx) _idx -= _length;
@@ -204,47 +348,47 @@ class PolygonIterator {
         return *this;
     }
 
-    PolygonIterator operator+(diff_type _n) const {
+    BasicPolygonIterator operator+(diff_type _n) const {
         auto ret = *this;
         ret += _n;
         return ret;
     }
 
-    PolygonIterator& operator-=(diff_type _n) {
+    BasicPolygonIterator& operator-=(diff_type _n) {
         return operator+=(-_n);
     }
 
-    PolygonIterator operator-(diff_type _n) const {
+    BasicPolygonIterator operator-(diff_type _n) const {
         auto ret = *this;
         ret -= _n;
         return ret;
     }
 
-    size_type operator-(const PolygonIterator& i) const {
+    size_type operator-(const BasicPolygonIterator& i) const {
         auto ret = _idx - i._idx;
         return ret < 0 ? ret + _length : ret;
     }
 
-    bool operator==(const PolygonIterator& i) const noexcept {
+    bool operator==(const BasicPolygonIterator& i) const noexcept {
         return _ptr == i._ptr;
     }
 
-    bool operator!=(const PolygonIterator& i) const noexcept {
+    bool operator!=(const BasicPolygonIterator& i) const noexcept {
         return !(*this == i);
     }
 
-    Point* operator->() const noexcept {
+    BasicPoint<T>* operator->() const noexcept {
         return &_ptr[_idx];
     }
 
-    friend Polygon;
+    friend BasicPolygon<T>;
 
    private:
     size_type       _idx;
     const size_type _length;
     pointer         _ptr;
 
-    PolygonIterator(const Polygon* _parent, size_type _n = 0)
+    BasicPolygonIterator(const BasicPolygon<T>* _parent, size_type _n = 0)
         : _idx(_n), _length(_parent->_num), _ptr(_parent->_points) {
         assert(check_idx());
     }
@@ -254,24 +398,32 @@ class PolygonIterator {
     }
 };
 
-PolygonIterator operator+(PolygonIterator::diff_type _n,
-                          const PolygonIterator&     _p) {
+template <class T>
+BasicPolygonIterator<T> operator+(
+    typename BasicPolygonIterator<T>::diff_type _n,
+    const BasicPolygonIterator<T>&              _p) {
     return _p + _n;
 }
 
-PolygonIterator operator-(PolygonIterator::diff_type _n,
-                          const PolygonIterator&     _p) {
+template <class T>
+BasicPolygonIterator<T> operator-(
+    typename BasicPolygonIterator<T>::diff_type _n,
+    const BasicPolygonIterator<T>&              _p) {
     return _p - _n;
 }
 
-PolygonIterator Polygon::begin() const {
-    return PolygonIterator(this);
+template <class T>
+BasicPolygonIterator<T> BasicPolygon<T>::begin() const {
+    return BasicPolygonIterator<T>(this);
 }
 
-PolygonIterator Polygon::end() const {
-    return PolygonIterator(this);
+template <class T>
+BasicPolygonIterator<T> BasicPolygon<T>::end() const {
+    return BasicPolygonIterator<T>(this);
 }
 
+using PolygonIterator = BasicPolygonIterator<Real>;
+
 }  // namespace geometry
 
 }  // namespace sapphre15
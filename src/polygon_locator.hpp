@@ -0,0 +1,316 @@
+#ifndef GEOMETRY_POLYGON_LOCATOR_HPP_
+#define GEOMETRY_POLYGON_LOCATOR_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "point_buffer.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief Locate points in a simple polygon with a uniform grid.
+ * The bounding box of the polygon is divided into about as many cells as
+ * the polygon has edges. Each cell keeps the edges that may touch it and
+ * whether its center is inside the polygon.
+ * A query in a cell without edges is answered by the status of the cell.
+ * Otherwise the edges of the cell crossed by the segment between the
+ * query and the center of the cell are counted. Only if that segment
+ * passes through a vertex, the edges of the row are scanned instead.
+ * Long edges are registered to every cell of their bounding boxes, so
+ * the index works best when the edges are short compared with the
+ * polygon.
+ */
+template <class T, class Predicate = EpsilonPredicate>
+class BasicPolygonLocator {
+   public:
+    using value_type = T;
+    using size_type  = std::size_t;
+    using point_type = BasicPoint<T>;
+    using real_type  = typename coordinate_traits<T>::real_type;
+
+    /**
+     * @brief build the index of the simple polygon.
+     * @param pl Polygon
+     */
+    explicit BasicPolygonLocator(const BasicPolygon<T> &pl) {
+        const size_type n = pl.size();
+        _edges.reserve(n);
+        for (size_type i = 0; i < n; i++) {
+            _edges.emplace_back(real_point(pl[i]),
+                                real_point(pl[(i + 1) % n]));
+        }
+        build_grid();
+        bucket_edges();
+        classify_cells();
+    }
+
+    /**
+     * @brief locate the point.
+     * @param p Point
+     * @return PointLocation
+     */
+    PointLocation locate(const point_type &p) const {
+        const real_point_type q = real_point(p);
+        if (q.x() < _min.x() - _mx || _max.x() + _mx < q.x() ||
+            q.y() < _min.y() - _my || _max.y() + _my < q.y()) {
+            return PointLocation::OUTSIDE;
+        }
+        const size_type ix = column(q.x()), iy = row(q.y()),
+                        cell = iy * _nx + ix;
+        const size_type first = _cell_begin[cell], last = _cell_begin[cell + 1];
+        if (first == last) {
+            return _status[cell] == INSIDE ? PointLocation::INSIDE
+                                           : PointLocation::OUTSIDE;
+        }
+        for (size_type k = first; k < last; k++) {
+            const auto &e = _edges[_cell_edges[k]];
+            if (ccw<Predicate>(e.first, e.second, q) == ON_SEGMENT) {
+                return PointLocation::ON_BOUNDARY;
+            }
+        }
+        if (_status[cell] != UNKNOWN) {
+            const real_point_type c = center(ix, iy);
+            bool                  odd = false, degenerate = false;
+            for (size_type k = first; k < last; k++) {
+                const auto &e  = _edges[_cell_edges[k]];
+                ClockWise   sa = ccw<Predicate>(q, c, e.first),
+                          sb = ccw<Predicate>(q, c, e.second);
+                if (sa == ON_SEGMENT || sb == ON_SEGMENT) {
+                    degenerate = true;
+                    break;
+                }
+                if (sa * sb == -1 &&
+                    ccw<Predicate>(e.first, e.second, q) *
+                            ccw<Predicate>(e.first, e.second, c) ==
+                        -1) {
+                    odd = !odd;
+                }
+            }
+            if (!degenerate) {
+                return (_status[cell] == INSIDE) != odd
+                           ? PointLocation::INSIDE
+                           : PointLocation::OUTSIDE;
+            }
+        }
+        return scan_row(iy, q);
+    }
+
+    /**
+     * @brief locate the n points starting from points into out.
+     */
+    void locate(const point_type *points,
+                size_type         n,
+                PointLocation    *out) const {
+        for (size_type i = 0; i < n; i++) out[i] = locate(points[i]);
+    }
+
+    /**
+     * @brief locate each point of the buffer into out.
+     */
+    void locate(const BasicPointBuffer<T> &buf, PointLocation *out) const {
+        const T *x = buf.x_data(), *y = buf.y_data();
+        for (size_type i = 0; i < buf.size(); i++) {
+            out[i] = locate(point_type(x[i], y[i]));
+        }
+    }
+
+    std::vector<PointLocation> locate(
+        const std::vector<point_type> &points) const {
+        std::vector<PointLocation> ret(points.size());
+        locate(points.data(), points.size(), ret.data());
+        return ret;
+    }
+
+    std::vector<PointLocation> locate(const BasicPointBuffer<T> &buf) const {
+        std::vector<PointLocation> ret(buf.size());
+        locate(buf, ret.data());
+        return ret;
+    }
+
+    /**
+     * @brief Check if the point is strictly inside the polygon.
+     */
+    bool inside(const point_type &p) const {
+        return locate(p) == PointLocation::INSIDE;
+    }
+
+    /**
+     * @brief Check if the point is on edges of the polygon.
+     */
+    bool on_object(const point_type &p) const {
+        return locate(p) == PointLocation::ON_BOUNDARY;
+    }
+
+    /**
+     * @brief Check if the point is strictly outside the polygon.
+     */
+    bool outside(const point_type &p) const {
+        return locate(p) == PointLocation::OUTSIDE;
+    }
+
+   private:
+    using real_point_type = BasicPoint<real_type>;
+    using edge_type       = std::pair<real_point_type, real_point_type>;
+
+    // セルの中心の状態
+    enum Status : signed char {
+        UNKNOWN = -1,  // 中心が境界上にある
+        OUTSIDE = 0,
+        INSIDE  = 1,
+    };
+
+    static real_point_type real_point(const point_type &p) {
+        return real_point_type(p);
+    }
+
+    size_type column(real_type x) const {
+        real_type v = std::floor((x - _min.x()) / _w);
+        return size_type(std::clamp(v, real_type(0), real_type(_nx - 1)));
+    }
+
+    size_type row(real_type y) const {
+        real_type v = std::floor((y - _min.y()) / _h);
+        return size_type(std::clamp(v, real_type(0), real_type(_ny - 1)));
+    }
+
+    real_point_type center(size_type ix, size_type iy) const {
+        return real_point_type(_min.x() + (ix + real_type(0.5)) * _w,
+                               _min.y() + (iy + real_type(0.5)) * _h);
+    }
+
+    // 辺の数と同程度のセルに分割する
+    void build_grid() {
+        _min = _max = _edges[0].first;
+        for (const auto &e : _edges) {
+            _min = real_point_type(std::min(_min.x(), e.first.x()),
+                                   std::min(_min.y(), e.first.y()));
+            _max = real_point_type(std::max(_max.x(), e.first.x()),
+                                   std::max(_max.y(), e.first.y()));
+        }
+        real_type width  = std::max(_max.x() - _min.x(), real_type(EPS)),
+                  height = std::max(_max.y() - _min.y(), real_type(EPS));
+        real_type cells  = real_type(_edges.size());
+        _nx = std::max(size_type(1),
+                       size_type(std::ceil(std::sqrt(cells * width / height))));
+        _ny = std::max(size_type(1), size_type(std::ceil(cells / _nx)));
+        _w  = width / _nx;
+        _h  = height / _ny;
+        _mx = _w * real_type(1e-6) + EPS;
+        _my = _h * real_type(1e-6) + EPS;
+    }
+
+    // 各辺を，その外接矩形を少し広げた範囲のセルと行に登録する
+    void bucket_edges() {
+        std::vector<std::pair<size_type, size_type>> cell_pairs, row_pairs;
+        for (size_type i = 0; i < _edges.size(); i++) {
+            const auto &e = _edges[i];
+            size_type   x0 = column(std::min(e.first.x(), e.second.x()) - _mx),
+                      x1 = column(std::max(e.first.x(), e.second.x()) + _mx),
+                      y0 = row(std::min(e.first.y(), e.second.y()) - _my),
+                      y1 = row(std::max(e.first.y(), e.second.y()) + _my);
+            for (size_type iy = y0; iy <= y1; iy++) {
+                row_pairs.emplace_back(iy, i);
+                for (size_type ix = x0; ix <= x1; ix++) {
+                    cell_pairs.emplace_back(iy * _nx + ix, i);
+                }
+            }
+        }
+        to_csr(cell_pairs, _nx * _ny, _cell_begin, _cell_edges);
+        to_csr(row_pairs, _ny, _row_begin, _row_edges);
+    }
+
+    static void to_csr(std::vector<std::pair<size_type, size_type>> &pairs,
+                       size_type               buckets,
+                       std::vector<size_type> &begin,
+                       std::vector<size_type> &items) {
+        begin.assign(buckets + 1, 0);
+        for (const auto &p : pairs) begin[p.first + 1]++;
+        for (size_type i = 0; i < buckets; i++) begin[i + 1] += begin[i];
+        items.resize(pairs.size());
+        std::vector<size_type> pos(std::begin(begin), std::end(begin) - 1);
+        for (const auto &p : pairs) items[pos[p.first]++] = p.second;
+    }
+
+    // 各行で，中心を通る水平線と辺との交点を左から数えて状態を決める
+    void classify_cells() {
+        _status.assign(_nx * _ny, OUTSIDE);
+        std::vector<real_type> xs;
+        for (size_type iy = 0; iy < _ny; iy++) {
+            const real_type cy = center(0, iy).y();
+            xs.clear();
+            for (size_type k = _row_begin[iy]; k < _row_begin[iy + 1]; k++) {
+                const auto &e = _edges[_row_edges[k]];
+                const real_point_type a = e.first, d = e.second - e.first;
+                if ((a.y() > cy) != (e.second.y() > cy)) {
+                    xs.push_back(a.x() + (cy - a.y()) * d.x() / d.y());
+                }
+            }
+            std::sort(std::begin(xs), std::end(xs));
+            size_type crossed = 0;
+            for (size_type ix = 0; ix < _nx; ix++) {
+                const real_point_type c    = center(ix, iy);
+                const size_type       cell = iy * _nx + ix;
+                while (crossed < xs.size() && xs[crossed] < c.x()) crossed++;
+                _status[cell] = crossed % 2 == 1 ? INSIDE : OUTSIDE;
+                for (size_type k = _cell_begin[cell];
+                     k < _cell_begin[cell + 1];
+                     k++) {
+                    const auto &e = _edges[_cell_edges[k]];
+                    if (ccw<Predicate>(e.first, e.second, c) == ON_SEGMENT) {
+                        _status[cell] = UNKNOWN;
+                    }
+                }
+            }
+        }
+    }
+
+    // Polygon::inside と同じ方法で，行に登録された辺だけを調べる
+    PointLocation scan_row(size_type iy, const real_point_type &q) const {
+        bool odd = false;
+        for (size_type k = _row_begin[iy]; k < _row_begin[iy + 1]; k++) {
+            real_point_type a = _edges[_row_edges[k]].first,
+                            b = _edges[_row_edges[k]].second;
+            if (ccw<Predicate>(a, b, q) == ON_SEGMENT) {
+                return PointLocation::ON_BOUNDARY;
+            }
+            if (a.y() < b.y()) std::swap(a, b);
+            if (!le(a.y(), q.y()) && le(b.y(), q.y()) &&
+                ccw<Predicate>(a, q, b) == COUNTER_CLOCKWISE) {
+                odd = !odd;
+            }
+        }
+        return odd ? PointLocation::INSIDE : PointLocation::OUTSIDE;
+    }
+
+    std::vector<edge_type> _edges;
+    // 外接矩形
+    real_point_type _min, _max;
+    // セルの個数と大きさ
+    size_type _nx, _ny;
+    real_type _w, _h;
+    // 誤差を見込んで外接矩形やセルを広げる幅
+    real_type _mx, _my;
+    // セル (ix, iy) の辺は _cell_edges[_cell_begin[iy * _nx + ix] ...]
+    std::vector<size_type> _cell_begin, _cell_edges;
+    // 行 iy の辺は _row_edges[_row_begin[iy] ...]
+    std::vector<size_type> _row_begin, _row_edges;
+    std::vector<Status>    _status;
+};
+
+using PolygonLocator = BasicPolygonLocator<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_POLYGON_LOCATOR_HPP_
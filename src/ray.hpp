@@ -1,6 +1,8 @@
 #ifndef GEOMETRY_RAY_HPP_
 #define GEOMETRY_RAY_HPP_
 
+#include <type_traits>
+
 #include "config.hpp"
 #include "line.hpp"
 #include "point.hpp"
@@ -9,56 +11,70 @@ namespace sapphre15 {
 
 namespace geometry {
 
-class Ray : public internal::LineBase {
+template <class T>
+class BasicRay : public internal::BasicLineBase<T> {
+    using Base = internal::BasicLineBase<T>;
+    using Base::_a;
+    using Base::_b;
+
    public:
-    Ray() : internal::LineBase() {
+    using typename Base::point_type;
+    using typename Base::real_type;
+    using typename Base::value_type;
+    using Base::direction;
+
+    BasicRay() : Base() {
     }
     // 点 start を始点とし end を結ぶ半直線
-    Ray(const Point &_start, const Point &_to)
-        : internal::LineBase(_start, _to) {
+    BasicRay(const point_type &_start, const point_type &_to)
+        : Base(_start, _to) {
     }
     // 点 start を始点とする傾き theta の半直線
-    Ray(const Point &_start, const Real theta)
-        : internal::LineBase(_start, _start + Point::polar(theta)) {
+    BasicRay(const point_type &_start, const real_type theta)
+        : Base(_start, _start + point_type::polar(theta)) {
     }
     // 半直線の始点
-    Point source() const {
+    point_type source() const {
         return _a;
     }
     // 始点のx座標
-    double x() const {
+    value_type x() const {
         return _a.x();
     }
     // 始点のy座標
-    double y() const {
+    value_type y() const {
         return _a.y();
     }
-    bool on_object(const Point &p) const {
+    bool on_object(const point_type &p) const {
         ClockWise val = ccw(_a, _b, p);
         return val == ONLINE_FRONT || val == ON_SEGMENT;
     }
     // v の方向に平行移動
-    Ray translation(const Point &v) const {
-        return Ray(_a + v, _b + v);
+    BasicRay translation(const point_type &v) const {
+        return BasicRay(_a + v, _b + v);
     }
     // x軸方向に dist だけ平行移動
-    Ray moveX(const Real &dist) const {
-        return translation(Point(dist, 0.0));
+    BasicRay moveX(const value_type &dist) const {
+        return translation(point_type(dist, 0));
     }
     // y軸方向に dist だけ平行移動
-    Ray moveY(const Real &dist) const {
-        return translation(Point(0.0, dist));
+    BasicRay moveY(const value_type &dist) const {
+        return translation(point_type(0, dist));
     }
     // 始点から終点方向から反時計回り回転させた方向に dist だけ平行移動
-    Ray moveV(const Real &dist) const {
+    BasicRay moveV(const value_type &dist) const {
         return translation(geometry::rotate(direction(), PI / 2) * dist);
     }
     // 始点を中心として theta だけ反時計回りに回転
-    Ray rotate(const Real &theta) const {
-        return Ray(_a, _a + geometry::rotate(_b - _a, theta));
+    BasicRay rotate(const real_type &theta) const {
+        return BasicRay(_a, _a + geometry::rotate(_b - _a, theta));
     }
 };
 
+static_assert(std::is_trivially_copyable<Ray>::value,
+              "Ray must be trivially copyable");
+static_assert(sizeof(Ray) == 2 * sizeof(Point), "Ray must be two points");
+
 }  // namespace geometry
 
 }  // namespace sapphre15
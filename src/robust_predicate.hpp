@@ -0,0 +1,534 @@
+#ifndef GEOMETRY_ROBUST_PREDICATE_HPP_
+#define GEOMETRY_ROBUST_PREDICATE_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+#include "config.hpp"
+#include "point.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+/**
+ * @brief Exact floating-point expansion arithmetic
+ * (J. R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic and
+ * Fast Robust Geometric Predicates").
+ * An expansion is a sequence of non-overlapping doubles sorted by
+ * increasing magnitude whose exact sum is the represented value.
+ * Expansions are stored in arrays given by the caller, whose sizes are
+ * bounded for each predicate, so no memory is allocated.
+ * These routines assume IEEE 754 round-to-nearest arithmetic in which
+ * no intermediate value underflows or overflows, and must not be
+ * compiled with -ffast-math.
+ */
+namespace expansion {
+
+// x + y == a + b exactly, where x = fl(a + b)
+void two_sum(Real a, Real b, Real &x, Real &y) {
+    x         = a + b;
+    Real bvir = x - a, avir = x - bvir;
+    y         = (a - avir) + (b - bvir);
+}
+
+// x + y == a + b exactly, assuming |a| >= |b|
+void fast_two_sum(Real a, Real b, Real &x, Real &y) {
+    x = a + b;
+    y = b - (x - a);
+}
+
+// y == (a - b) - x exactly, where x = fl(a - b)
+void two_diff_tail(Real a, Real b, Real x, Real &y) {
+    Real bvir = a - x, avir = x + bvir;
+    y         = (a - avir) + (bvir - b);
+}
+
+// x + y == a - b exactly, where x = fl(a - b)
+void two_diff(Real a, Real b, Real &x, Real &y) {
+    x = a - b;
+    two_diff_tail(a, b, x, y);
+}
+
+// x + y == a * b exactly, where x = fl(a * b)
+void two_product(Real a, Real b, Real &x, Real &y) {
+    x = a * b;
+#ifdef __FP_FAST_FMA
+    y = std::fma(a, b, -x);
+#else
+    // fma が命令にならないときは Dekker の方法で 26 ビットずつに分ける
+    constexpr Real SPLITTER = 134217729.0;  // 2^27 + 1
+    Real           c = SPLITTER * a, ahi = c - (c - a), alo = a - ahi;
+    Real           d = SPLITTER * b, bhi = d - (d - b), blo = b - bhi;
+    y = alo * blo - (((x - ahi * bhi) - alo * bhi) - ahi * blo);
+#endif
+}
+
+// (x3, x2, x1, x0) == (a1 + a0) + (b1 + b0) exactly
+void two_two_sum(Real a1, Real a0, Real b1, Real b0, Real *x) {
+    Real i, j, k;
+    two_sum(a0, b0, i, x[0]);
+    two_sum(a1, i, j, k);
+    two_sum(k, b1, i, x[1]);
+    two_sum(j, i, x[3], x[2]);
+}
+
+// (x3, x2, x1, x0) == (a1 + a0) - (b1 + b0) exactly
+void two_two_diff(Real a1, Real a0, Real b1, Real b0, Real *x) {
+    two_two_sum(a1, a0, -b1, -b0, x);
+}
+
+// a * b - c * d を4項で表す
+void cross(Real a, Real b, Real c, Real d, Real *x) {
+    Real s1, s0, t1, t0;
+    two_product(a, b, s1, s0);
+    two_product(c, d, t1, t0);
+    two_two_diff(s1, s0, t1, t0, x);
+}
+
+/**
+ * @brief h = e + f (fast_expansion_sum_zeroelim).
+ * The components are merged by magnitude in one pass. h has at most
+ * elen + flen components and must not overlap e or f.
+ * @return the number of components of h
+ */
+std::size_t sum(std::size_t elen,
+                const Real *e,
+                std::size_t flen,
+                const Real *f,
+                Real       *h) {
+    std::size_t i = 0, j = 0, k = 0;
+    // 絶対値の小さい方から取り出す
+    auto next = [&]() {
+        if (j == flen || (i < elen && (f[j] > e[i]) == (f[j] > -e[i]))) {
+            return e[i++];
+        }
+        return f[j++];
+    };
+    Real q = next(), hh;
+    if (i < elen && j < flen) {
+        fast_two_sum(next(), q, q, hh);
+        if (hh != 0) h[k++] = hh;
+    }
+    while (i < elen || j < flen) {
+        two_sum(q, next(), q, hh);
+        if (hh != 0) h[k++] = hh;
+    }
+    if (q != 0 || k == 0) h[k++] = q;
+    return k;
+}
+
+/**
+ * @brief h = e * b (scale_expansion_zeroelim).
+ * h has at most 2 elen components and must not overlap e.
+ * @return the number of components of h
+ */
+std::size_t scale(std::size_t elen, const Real *e, Real b, Real *h) {
+    std::size_t k = 0;
+    Real        q, hh;
+    two_product(e[0], b, q, hh);
+    if (hh != 0) h[k++] = hh;
+    for (std::size_t i = 1; i < elen; i++) {
+        Real p1, p0, s;
+        two_product(e[i], b, p1, p0);
+        two_sum(q, p0, s, hh);
+        if (hh != 0) h[k++] = hh;
+        fast_two_sum(p1, s, q, hh);
+        if (hh != 0) h[k++] = hh;
+    }
+    if (q != 0 || k == 0) h[k++] = q;
+    return k;
+}
+
+// 各成分の和の近似値
+Real estimate(std::size_t elen, const Real *e) {
+    Real q = e[0];
+    for (std::size_t i = 1; i < elen; i++) q += e[i];
+    return q;
+}
+
+}  // namespace expansion
+
+}  // namespace internal
+
+/**
+ * @brief Adaptive precision predicates.
+ * Each predicate first evaluates the determinant in plain floating-point
+ * arithmetic and checks it against a forward error bound (stage A).
+ * If the bound cannot certify the sign, the determinant of the rounded
+ * differences is computed exactly (stage B), then corrected with the
+ * first-order terms of the rounding errors of the differences (stage C),
+ * and only if that is still uncertain the remaining terms are added to
+ * get the exact value (stage D). The sign of the returned value is
+ * always exact; its magnitude is only an approximation.
+ */
+namespace robust {
+
+// epsilon in Shewchuk's paper, half an ulp of 1.0
+constexpr Real MACHINE_EPSILON = 1.1102230246251565e-16;
+constexpr Real RESULT_ERRBOUND =
+    (3.0 + 8.0 * MACHINE_EPSILON) * MACHINE_EPSILON;
+constexpr Real CCW_ERRBOUND_A =
+    (3.0 + 16.0 * MACHINE_EPSILON) * MACHINE_EPSILON;
+constexpr Real CCW_ERRBOUND_B =
+    (2.0 + 12.0 * MACHINE_EPSILON) * MACHINE_EPSILON;
+constexpr Real CCW_ERRBOUND_C =
+    (9.0 + 64.0 * MACHINE_EPSILON) * MACHINE_EPSILON * MACHINE_EPSILON;
+constexpr Real ICC_ERRBOUND_A =
+    (10.0 + 96.0 * MACHINE_EPSILON) * MACHINE_EPSILON;
+constexpr Real ICC_ERRBOUND_B =
+    (4.0 + 48.0 * MACHINE_EPSILON) * MACHINE_EPSILON;
+constexpr Real ICC_ERRBOUND_C =
+    (44.0 + 576.0 * MACHINE_EPSILON) * MACHINE_EPSILON * MACHINE_EPSILON;
+
+// orient2d の段階 B 以降。detsum は |detleft| + |detright|
+Real orient2d_adapt(const Point &a,
+                    const Point &b,
+                    const Point &c,
+                    Real         detsum) {
+    namespace ex = internal::expansion;
+    const Real acx = a.x() - c.x(), bcx = b.x() - c.x();
+    const Real acy = a.y() - c.y(), bcy = b.y() - c.y();
+    Real       det4[4];
+    ex::cross(acx, bcy, acy, bcx, det4);
+    Real det      = ex::estimate(4, det4);
+    Real errbound = CCW_ERRBOUND_B * detsum;
+    if (det >= errbound || -det >= errbound) return det;
+
+    Real acxtail, bcxtail, acytail, bcytail;
+    ex::two_diff_tail(a.x(), c.x(), acx, acxtail);
+    ex::two_diff_tail(b.x(), c.x(), bcx, bcxtail);
+    ex::two_diff_tail(a.y(), c.y(), acy, acytail);
+    ex::two_diff_tail(b.y(), c.y(), bcy, bcytail);
+    if (acxtail == 0 && acytail == 0 && bcxtail == 0 && bcytail == 0) {
+        return det;
+    }
+    errbound = CCW_ERRBOUND_C * detsum + RESULT_ERRBOUND * std::abs(det);
+    det += (acx * bcytail + bcy * acxtail) - (acy * bcxtail + bcx * acytail);
+    if (det >= errbound || -det >= errbound) return det;
+
+    Real        u[4], c1[8], c2[12], d[16];
+    std::size_t c1len, c2len, dlen;
+    ex::cross(acxtail, bcy, acytail, bcx, u);
+    c1len = ex::sum(4, det4, 4, u, c1);
+    ex::cross(acx, bcytail, acy, bcxtail, u);
+    c2len = ex::sum(c1len, c1, 4, u, c2);
+    ex::cross(acxtail, bcytail, acytail, bcxtail, u);
+    dlen = ex::sum(c2len, c2, 4, u, d);
+    return d[dlen - 1];
+}
+
+/**
+ * @brief twice the signed area of the triangle abc.
+ * Positive if a, b, c are counter-clockwise, negative if clockwise
+ * and zero if they are colinear.
+ */
+Real orient2d(const Point &a, const Point &b, const Point &c) {
+    Real detleft  = (a.x() - c.x()) * (b.y() - c.y());
+    Real detright = (a.y() - c.y()) * (b.x() - c.x());
+    Real det      = detleft - detright;
+    Real detsum;
+    if (detleft > 0) {
+        if (detright <= 0) return det;
+        detsum = detleft + detright;
+    } else if (detleft < 0) {
+        if (detright >= 0) return det;
+        detsum = -detleft - detright;
+    } else {
+        return det;
+    }
+    Real errbound = CCW_ERRBOUND_A * detsum;
+    if (det >= errbound || -det >= errbound) return det;
+    return orient2d_adapt(a, b, c, detsum);
+}
+
+/**
+ * @brief stages B, C and D of incircle.
+ * The three terms of the determinant are symmetric under the cyclic
+ * permutation of a, b, c, so they are computed in a loop over i, with
+ * j = i + 1 and k = i + 2 modulo 3.
+ * @param permanent the permanent of the determinant
+ */
+Real incircle_adapt(const Point &a,
+                    const Point &b,
+                    const Point &c,
+                    const Point &d,
+                    Real         permanent) {
+    namespace ex            = internal::expansion;
+    const Point *const v[3] = {&a, &b, &c};
+    Real               dx[3], dy[3], dxt[3], dyt[3];
+    for (int i = 0; i < 3; i++) {
+        ex::two_diff(v[i]->x(), d.x(), dx[i], dxt[i]);
+        ex::two_diff(v[i]->y(), d.y(), dy[i], dyt[i]);
+    }
+
+    // cr[i] = dx[j] dy[k] - dx[k] dy[j] として
+    // det = sum (dx[i]^2 + dy[i]^2) cr[i]
+    Real        cr[3][4], fin1[1152], fin2[1152];
+    Real        t8[8], t16a[16], t16b[16], t32[32], t64[64];
+    Real       *fin = fin1, *other = fin2;
+    std::size_t finlen = 0;
+    // fin に n 項の t を加える
+    auto add = [&](std::size_t n, const Real *t) {
+        finlen = ex::sum(finlen, fin, n, t, other);
+        std::swap(fin, other);
+    };
+    fin[finlen++] = 0;
+    for (int i = 0; i < 3; i++) {
+        const int j = (i + 1) % 3, k = (i + 2) % 3;
+        ex::cross(dx[j], dy[k], dx[k], dy[j], cr[i]);
+        std::size_t xlen  = ex::scale(4, cr[i], dx[i], t8);
+        std::size_t xxlen = ex::scale(xlen, t8, dx[i], t16a);
+        std::size_t ylen  = ex::scale(4, cr[i], dy[i], t8);
+        std::size_t yylen = ex::scale(ylen, t8, dy[i], t16b);
+        add(ex::sum(xxlen, t16a, yylen, t16b, t32), t32);
+    }
+    Real det      = ex::estimate(finlen, fin);
+    Real errbound = ICC_ERRBOUND_B * permanent;
+    if (det >= errbound || -det >= errbound) return det;
+
+    bool tail[3];
+    for (int i = 0; i < 3; i++) tail[i] = dxt[i] != 0 || dyt[i] != 0;
+    if (!tail[0] && !tail[1] && !tail[2]) return det;
+
+    errbound = ICC_ERRBOUND_C * permanent + RESULT_ERRBOUND * std::abs(det);
+    for (int i = 0; i < 3; i++) {
+        const int j = (i + 1) % 3, k = (i + 2) % 3;
+        det += (dx[i] * dx[i] + dy[i] * dy[i]) *
+                   ((dx[j] * dyt[k] + dy[k] * dxt[j]) -
+                    (dy[j] * dxt[k] + dx[k] * dyt[j])) +
+               2.0 * (dx[i] * dxt[i] + dy[i] * dyt[i]) *
+                   (dx[j] * dy[k] - dy[j] * dx[k]);
+    }
+    if (det >= errbound || -det >= errbound) return det;
+
+    // lift[i] = dx[i]^2 + dy[i]^2
+    Real lift[3][4];
+    for (int i = 0; i < 3; i++) {
+        Real s1, s0, t1, t0;
+        ex::two_product(dx[i], dx[i], s1, s0);
+        ex::two_product(dy[i], dy[i], t1, t0);
+        ex::two_two_sum(s1, s0, t1, t0, lift[i]);
+    }
+    // 差の誤差について1次の項
+    Real        xt[3][8], yt[3][8], t48[48];
+    std::size_t xtlen[3], ytlen[3];
+    for (int i = 0; i < 3; i++) {
+        const int   j = (i + 1) % 3, k = (i + 2) % 3;
+        std::size_t alen, blen, clen, len;
+        if (dxt[i] != 0) {
+            xtlen[i] = ex::scale(4, cr[i], dxt[i], xt[i]);
+            alen     = ex::scale(xtlen[i], xt[i], 2.0 * dx[i], t16a);
+            len      = ex::scale(4, lift[k], dxt[i], t8);
+            blen     = ex::scale(len, t8, dy[j], t16b);
+            len      = ex::sum(alen, t16a, blen, t16b, t32);
+            alen     = ex::scale(4, lift[j], dxt[i], t8);
+            clen     = ex::scale(alen, t8, -dy[k], t16a);
+            add(ex::sum(clen, t16a, len, t32, t48), t48);
+        }
+        if (dyt[i] != 0) {
+            ytlen[i] = ex::scale(4, cr[i], dyt[i], yt[i]);
+            alen     = ex::scale(ytlen[i], yt[i], 2.0 * dy[i], t16a);
+            len      = ex::scale(4, lift[j], dyt[i], t8);
+            blen     = ex::scale(len, t8, dx[k], t16b);
+            len      = ex::sum(alen, t16a, blen, t16b, t32);
+            alen     = ex::scale(4, lift[k], dyt[i], t8);
+            clen     = ex::scale(alen, t8, -dx[j], t16a);
+            add(ex::sum(clen, t16a, len, t32, t48), t48);
+        }
+    }
+    // 残りの2次以上の項
+    for (int i = 0; i < 3; i++) {
+        if (!tail[i]) continue;
+        const int   j = (i + 1) % 3, k = (i + 2) % 3;
+        Real        ct[8], ctt[4], u[4], w[4], t32b[32];
+        std::size_t ctlen = 1, cttlen = 1;
+        ct[0] = ctt[0] = 0;
+        if (tail[j] || tail[k]) {
+            Real s1, s0, t1, t0;
+            ex::two_product(dxt[j], dy[k], s1, s0);
+            ex::two_product(dx[j], dyt[k], t1, t0);
+            ex::two_two_sum(s1, s0, t1, t0, u);
+            ex::two_product(dxt[k], -dy[j], s1, s0);
+            ex::two_product(dx[k], -dyt[j], t1, t0);
+            ex::two_two_sum(s1, s0, t1, t0, w);
+            ctlen = ex::sum(4, u, 4, w, ct);
+            ex::cross(dxt[j], dyt[k], dxt[k], dyt[j], ctt);
+            cttlen = 4;
+        }
+        // r = 0 は x 座標，r = 1 は y 座標の誤差の項
+        for (int r = 0; r < 2; r++) {
+            const Real h = r == 0 ? dxt[i] : dyt[i];
+            const Real g = r == 0 ? dx[i] : dy[i];
+            if (h == 0) continue;
+            const Real *e    = r == 0 ? xt[i] : yt[i];
+            std::size_t elen = r == 0 ? xtlen[i] : ytlen[i];
+            Real        hct[16], hctt[8];
+            std::size_t alen, blen, len, hctlen, hcttlen;
+            alen   = ex::scale(elen, e, h, t16a);
+            hctlen = ex::scale(ctlen, ct, h, hct);
+            blen   = ex::scale(hctlen, hct, 2.0 * g, t32);
+            add(ex::sum(alen, t16a, blen, t32, t48), t48);
+            if (r == 0 && dyt[j] != 0) {
+                len  = ex::scale(4, lift[k], h, t8);
+                alen = ex::scale(len, t8, dyt[j], t16a);
+                add(alen, t16a);
+            }
+            if (r == 0 && dyt[k] != 0) {
+                len  = ex::scale(4, lift[j], -h, t8);
+                alen = ex::scale(len, t8, dyt[k], t16a);
+                add(alen, t16a);
+            }
+            len     = ex::scale(hctlen, hct, h, t32);
+            hcttlen = ex::scale(cttlen, ctt, h, hctt);
+            alen    = ex::scale(hcttlen, hctt, 2.0 * g, t16a);
+            blen    = ex::scale(hcttlen, hctt, h, t16b);
+            alen    = ex::sum(alen, t16a, blen, t16b, t32b);
+            add(ex::sum(len, t32, alen, t32b, t64), t64);
+        }
+    }
+    return fin[finlen - 1];
+}
+
+/**
+ * @brief in-circle determinant of a, b, c and d.
+ * If a, b, c are counter-clockwise, the result is positive when d lies
+ * inside the circle through them, negative when outside and zero when
+ * d is on the circle. The sign is reversed if a, b, c are clockwise.
+ */
+Real incircle(const Point &a, const Point &b, const Point &c, const Point &d) {
+    Real adx = a.x() - d.x(), bdx = b.x() - d.x(), cdx = c.x() - d.x();
+    Real ady = a.y() - d.y(), bdy = b.y() - d.y(), cdy = c.y() - d.y();
+
+    Real bdxcdy = bdx * cdy, cdxbdy = cdx * bdy;
+    Real alift  = adx * adx + ady * ady;
+    Real cdxady = cdx * ady, adxcdy = adx * cdy;
+    Real blift  = bdx * bdx + bdy * bdy;
+    Real adxbdy = adx * bdy, bdxady = bdx * ady;
+    Real clift  = cdx * cdx + cdy * cdy;
+
+    Real det = alift * (bdxcdy - cdxbdy) + blift * (cdxady - adxcdy) +
+               clift * (adxbdy - bdxady);
+    Real permanent = (std::abs(bdxcdy) + std::abs(cdxbdy)) * alift +
+                     (std::abs(cdxady) + std::abs(adxcdy)) * blift +
+                     (std::abs(adxbdy) + std::abs(bdxady)) * clift;
+    Real errbound = ICC_ERRBOUND_A * permanent;
+    if (det > errbound || -det > errbound) return det;
+    return incircle_adapt(a, b, c, d, permanent);
+}
+
+}  // namespace robust
+
+/**
+ * @brief 誤差なしで判定する述語
+ * 浮動小数点数の座標は double に誤差なく変換して robust::orient2d,
+ * robust::incircle の符号のみを用いるので，座標の大きさに依らず正しい
+ * 結果を返す。整数座標は EpsilonPredicate と同じく product_type と
+ * __int128 で厳密に計算する（config.hpp の範囲内で）。
+ * long double は double に誤差なく変換できないので使えない。
+ * 使用例: ccw<ExactPredicate>(a, b, c)
+ */
+struct ExactPredicate {
+    template <class T>
+    static ClockWise ccw(const BasicPoint<T> &a,
+                         const BasicPoint<T> &b,
+                         const BasicPoint<T> &c) {
+        if constexpr (coordinate_traits<T>::is_exact) {
+            return EpsilonPredicate::ccw(a, b, c);
+        } else {
+            return ccw_real(to_real(a), to_real(b), to_real(c));
+        }
+    }
+
+    template <class T>
+    static bool in_circle(const BasicPoint<T> &p,
+                          const BasicPoint<T> &q,
+                          const BasicPoint<T> &r,
+                          const BasicPoint<T> &s) {
+        return side(p, q, r, s) > 0;
+    }
+
+    template <class T>
+    static bool on_circle(const BasicPoint<T> &p,
+                          const BasicPoint<T> &q,
+                          const BasicPoint<T> &r,
+                          const BasicPoint<T> &s) {
+        if constexpr (coordinate_traits<T>::is_exact) {
+            return sgn(co_circle_internal1(p, q, r, s)) == 0;
+        } else {
+            return robust::incircle(
+                       to_real(p), to_real(q), to_real(r), to_real(s)) == 0;
+        }
+    }
+
+    template <class T>
+    static bool out_circle(const BasicPoint<T> &p,
+                           const BasicPoint<T> &q,
+                           const BasicPoint<T> &r,
+                           const BasicPoint<T> &s) {
+        return side(p, q, r, s) < 0;
+    }
+
+    // 座標が完全に一致するときだけ同じ点とみなす
+    template <class T>
+    static bool equal(const BasicPoint<T> &a, const BasicPoint<T> &b) {
+        return a.x() == b.x() && a.y() == b.y();
+    }
+
+   private:
+    // float と double は double に誤差なく変換できる
+    template <class T>
+    static Point to_real(const BasicPoint<T> &p) {
+        static_assert(sizeof(T) <= sizeof(Real),
+                      "ExactPredicate needs coordinates exact in double");
+        return Point(p);
+    }
+
+    static ClockWise ccw_real(const Point &a, const Point &b, const Point &c) {
+        Real det = robust::orient2d(a, b, c);
+        if (det > 0) return COUNTER_CLOCKWISE;
+        if (det < 0) return CLOCKWISE;
+        // a, b, c は厳密に一直線上にあるので，座標の大小だけで位置が決まる
+        Real s, e, t;
+        if (a.x() != b.x()) {
+            s = a.x(), e = b.x(), t = c.x();
+        } else if (a.y() != b.y()) {
+            s = a.y(), e = b.y(), t = c.y();
+        } else {
+            return (c.x() == a.x() && c.y() == a.y()) ? ON_SEGMENT
+                                                      : ONLINE_FRONT;
+        }
+        if (e < s) s = -s, e = -e, t = -t;
+        if (t < s) return ONLINE_BACK;
+        if (t <= e) return ON_SEGMENT;
+        return ONLINE_FRONT;
+    }
+
+    // s が円の内部なら 1, 円周上なら 0, 外部なら -1
+    // p, q, r が一直線上のときは 0
+    template <class T>
+    static int side(const BasicPoint<T> &p,
+                    const BasicPoint<T> &q,
+                    const BasicPoint<T> &r,
+                    const BasicPoint<T> &s) {
+        if constexpr (coordinate_traits<T>::is_exact) {
+            return sgn(co_circle_internal2(p, q, r, s)) *
+                   sgn(co_circle_internal1(p, q, r, s));
+        } else {
+            const Point a = to_real(p), b = to_real(q), c = to_real(r);
+            Real o = robust::orient2d(a, b, c),
+                 d = robust::incircle(a, b, c, to_real(s));
+            int so = (o > 0) - (o < 0), sd = (d > 0) - (d < 0);
+            return so * sd;
+        }
+    }
+};
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_ROBUST_PREDICATE_HPP_
@@ -0,0 +1,189 @@
+#ifndef GEOMETRY_ROTATING_CALIPERS_HPP_
+#define GEOMETRY_ROTATING_CALIPERS_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+/**
+ * @brief call f(i, r, t, l) for each edge i of the convex polygon.
+ * Seen along the edge from pl[i] to pl[i + 1], pl[r] is the farthest
+ * vertex ahead, pl[t] is the farthest vertex on the left and pl[l] is
+ * the farthest vertex behind. The three calipers only move forward, so
+ * it takes O(n) time in total. The indices are taken modulo n, and
+ * edges of length 0 are skipped.
+ */
+template <class T, class Function>
+void for_each_caliper(const BasicPolygon<T> &pl, Function f) {
+    const std::size_t n  = pl.size();
+    auto              at = [&](std::size_t k) -> const BasicPoint<T> & {
+        return pl[k % n];
+    };
+    auto edge = [&](std::size_t k) { return at(k + 1) - at(k); };
+    std::size_t r = 1, t = 1, l = 1;
+    for (std::size_t i = 0; i < n; i++) {
+        const BasicPoint<T> e = edge(i);
+        if (sgn(norm(e)) == 0) continue;
+        r = std::max(r, i + 1);
+        while (sgn(dot(edge(r), e)) > 0) r++;
+        t = std::max(t, r);
+        while (sgn(cross(e, edge(t))) > 0) t++;
+        l = std::max(l, t);
+        while (sgn(dot(edge(l), e)) < 0) l++;
+        f(i, r % n, t % n, l % n);
+    }
+}
+
+// 辺 i の向きに合わせた外接長方形の幅と高さ
+template <class T>
+std::pair<typename coordinate_traits<T>::real_type,
+          typename coordinate_traits<T>::real_type>
+caliper_extent(const BasicPolygon<T> &pl,
+               std::size_t            i,
+               std::size_t            r,
+               std::size_t            t,
+               std::size_t            l) {
+    using R                = typename coordinate_traits<T>::real_type;
+    const BasicPoint<T> &o   = pl[i];
+    const BasicPoint<T>  e   = pl[(i + 1) % pl.size()] - o;
+    const R              len = abs(e);
+    return {R(dot(pl[r] - o, e) - dot(pl[l] - o, e)) / len,
+            R(cross(e, pl[t] - o)) / len};
+}
+
+// 外接長方形のうち score が最小のもの
+template <class T, class Score>
+BasicPolygon<typename coordinate_traits<T>::real_type> min_rectangle(
+    const BasicPolygon<T> &pl,
+    Score                  score) {
+    using R = typename coordinate_traits<T>::real_type;
+    std::size_t best_i = 0, best_r = 0, best_t = 0, best_l = 0;
+    R           best   = 0;
+    bool        found  = false;
+    for_each_caliper(
+        pl, [&](std::size_t i, std::size_t r, std::size_t t, std::size_t l) {
+            auto [w, h] = caliper_extent(pl, i, r, t, l);
+            if (!found || score(w, h) < best) {
+                found  = true;
+                best   = score(w, h);
+                best_i = i, best_r = r, best_t = t, best_l = l;
+            }
+        });
+    assert(found);
+    const BasicPoint<R> o(pl[best_i]);
+    const BasicPoint<R> e(pl[(best_i + 1) % pl.size()] - pl[best_i]);
+    const BasicPoint<R> u = e / abs(e), v(-u.y(), u.x());
+    const R             front  = dot(BasicPoint<R>(pl[best_r]) - o, u);
+    const R             back   = dot(BasicPoint<R>(pl[best_l]) - o, u);
+    const R             height = cross(u, BasicPoint<R>(pl[best_t]) - o);
+    return BasicPolygon<R>({o + u * back,
+                            o + u * front,
+                            o + u * front + v * height,
+                            o + u * back + v * height});
+}
+
+}  // namespace internal
+
+/**
+ * @brief find the farthest pair of vertexes of the convex polygon
+ * by rotating calipers in O(n) time.
+ * verified with
+ * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/4/CGL_4_B
+ * @param pl Polygon. It must be convex.
+ * @return std::tuple (i, j, d), where d is the squared distance between
+ * pl[i] and pl[j].
+ */
+template <class T>
+std::tuple<std::size_t,
+           std::size_t,
+           typename coordinate_traits<T>::product_type>
+convex_diameter(const BasicPolygon<T> &pl) {
+    const std::size_t n = pl.size();
+    // x 座標が最小の点と最大の点から始める
+    std::size_t i = 0, j = 0;
+    for (std::size_t k = 1; k < n; k++) {
+        if (pl[k].x() < pl[i].x()) i = k;
+        if (pl[j].x() < pl[k].x()) j = k;
+    }
+    std::tuple<std::size_t,
+               std::size_t,
+               typename coordinate_traits<T>::product_type>
+        best(i, j, norm(pl[i] - pl[j]));
+    // i と j が合わせて一周するまで，辺が先に回り込む方を進める
+    for (std::size_t step = 0; step < n; step++) {
+        const std::size_t ni = (i + 1) % n, nj = (j + 1) % n;
+        if (sgn(cross(pl[ni] - pl[i], pl[nj] - pl[j])) < 0) {
+            i = ni;
+        } else {
+            j = nj;
+        }
+        auto d = norm(pl[i] - pl[j]);
+        if (std::get<2>(best) < d) best = {i, j, d};
+    }
+    return best;
+}
+
+/**
+ * @brief calculate the width of the convex polygon, the minimum distance
+ * between two parallel lines that hold the polygon between them.
+ * It takes O(n) time.
+ * @param pl Polygon. It must be convex.
+ */
+template <class T>
+typename coordinate_traits<T>::real_type convex_width(
+    const BasicPolygon<T> &pl) {
+    using R = typename coordinate_traits<T>::real_type;
+    R    best  = 0;
+    bool found = false;
+    internal::for_each_caliper(
+        pl, [&](std::size_t i, std::size_t r, std::size_t t, std::size_t l) {
+            R h = internal::caliper_extent(pl, i, r, t, l).second;
+            if (!found || h < best) best = h, found = true;
+        });
+    return best;
+}
+
+/**
+ * @brief find the enclosing rectangle of the convex polygon with the
+ * minimum area in O(n) time.
+ * One side of the optimal rectangle contains an edge of the polygon, so
+ * only the rectangles along the edges are checked.
+ * @param pl Polygon. It must be convex.
+ * @return Polygon with four vertexes in counterclockwise order
+ */
+template <class T>
+BasicPolygon<typename coordinate_traits<T>::real_type> min_area_rectangle(
+    const BasicPolygon<T> &pl) {
+    using R = typename coordinate_traits<T>::real_type;
+    return internal::min_rectangle(pl, [](R w, R h) { return w * h; });
+}
+
+/**
+ * @brief find the enclosing rectangle of the convex polygon with the
+ * minimum perimeter in O(n) time.
+ * See min_area_rectangle.
+ */
+template <class T>
+BasicPolygon<typename coordinate_traits<T>::real_type>
+min_perimeter_rectangle(const BasicPolygon<T> &pl) {
+    using R = typename coordinate_traits<T>::real_type;
+    return internal::min_rectangle(pl, [](R w, R h) { return 2 * (w + h); });
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_ROTATING_CALIPERS_HPP_
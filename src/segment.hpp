@@ -2,6 +2,7 @@
 #define GEOMETRY_SEGMENT_HPP_
 
 #include <cmath>
+#include <type_traits>
 #include <utility>
 
 #include "config.hpp"
@@ -12,84 +13,100 @@ namespace sapphre15 {
 
 namespace geometry {
 
-class Segment : public internal::LineBase {
+template <class T>
+class BasicSegment : public internal::BasicLineBase<T> {
+    using Base = internal::BasicLineBase<T>;
+    using Base::_a;
+    using Base::_b;
+
    public:
-    Segment() : internal::LineBase() {
+    using typename Base::point_type;
+    using typename Base::real_type;
+    using typename Base::value_type;
+    using Base::direction;
+
+    BasicSegment() : Base() {
     }
     // 点 start, end を結ぶ線分
-    Segment(const Point &_start, const Point &_end)
-        : internal::LineBase(_start, _end) {
+    BasicSegment(const point_type &_start, const point_type &_end)
+        : Base(_start, _end) {
     }
     // 点 start を始点とする長さ length 、傾き theta の線分
-    Segment(const Point &_start, const Real _theta, const Real _length)
-        : internal::LineBase(_start, _start + Point::polar(_theta, _length)) {
+    BasicSegment(const point_type &_start,
+                 const real_type   _theta,
+                 const real_type   _length)
+        : Base(_start, _start + point_type::polar(_theta, _length)) {
     }
 
     // 始点を返す
-    Point start() const {
+    point_type start() const {
         return _a;
     }
     // 終点を返す
-    Point end() const {
+    point_type end() const {
         return _b;
     }
     // 始点のx座標
-    double x1() const {
+    value_type x1() const {
         return _a.x();
     }
     // 始点のy座標
-    double y1() const {
+    value_type y1() const {
         return _a.y();
     }
     // 終点のx座標
-    double x2() const {
+    value_type x2() const {
         return _b.x();
     }
     // 終点のy座標
-    double y2() const {
+    value_type y2() const {
         return _b.y();
     }
     // 線分のx方向の幅
-    double dx() const {
+    value_type dx() const {
         return std::abs(_a.x() - _b.x());
     }
     // 線分のy方向の幅
-    double dy() const {
+    value_type dy() const {
         return std::abs(_a.y() - _b.y());
     }
     // 線分の長さ
-    double length() {
+    real_type length() {
         return abs(_a - _b);
     }
-    bool on_object(const Point &p) const {
+    bool on_object(const point_type &p) const {
         return ccw(_a, _b, p) == ON_SEGMENT;
     }
     // 端点を返す
-    std::pair<Point, Point> end_points() const {
+    std::pair<point_type, point_type> end_points() const {
         return std::make_pair(_a, _b);
     }
     // v の方向に平行移動
-    Segment translation(const Point &v) const {
-        return Segment(_a + v, _b + v);
+    BasicSegment translation(const point_type &v) const {
+        return BasicSegment(_a + v, _b + v);
     }
     // x軸方向に dist だけ平行移動
-    Segment moveX(const Real &dist) const {
-        return translation(Point(dist, 0.0));
+    BasicSegment moveX(const value_type &dist) const {
+        return translation(point_type(dist, 0));
     }
     // y軸方向に dist だけ平行移動
-    Segment moveY(const Real &dist) const {
-        return translation(Point(0.0, dist));
+    BasicSegment moveY(const value_type &dist) const {
+        return translation(point_type(0, dist));
     }
     // 始点から終点方向から反時計回り回転させた方向に dist だけ平行移動
-    Segment moveV(const Real &dist) const {
+    BasicSegment moveV(const value_type &dist) const {
         return translation(geometry::rotate(direction(), PI / 2) * dist);
     }
     // 始点を中心として theta だけ反時計回りに回転
-    Segment rotate(const Real &theta) const {
-        return Segment(_a, _a + geometry::rotate(_b - _a, theta));
+    BasicSegment rotate(const real_type &theta) const {
+        return BasicSegment(_a, _a + geometry::rotate(_b - _a, theta));
     }
 };
 
+static_assert(std::is_trivially_copyable<Segment>::value,
+              "Segment must be trivially copyable");
+static_assert(sizeof(Segment) == 2 * sizeof(Point), "Segment must be two points");
+
 }  // namespace geometry
 
 }  // namespace sapphre15
@@ -0,0 +1,247 @@
+#ifndef GEOMETRY_SEGMENT_INTERSECTION_HPP_
+#define GEOMETRY_SEGMENT_INTERSECTION_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+#include "segment.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+namespace internal {
+
+/**
+ * @brief Bentley-Ottmann algorithm.
+ * The sweep line moves from left to right, and from bottom to top on a
+ * vertical line. The segments crossing the sweep line are kept sorted
+ * from bottom to top, and only the segments that become neighbors are
+ * tested. Every event point is processed once with all the segments
+ * through it, so the pairs are reported in O((n + k) log n) time.
+ */
+template <class T, class Predicate>
+class BentleyOttmann {
+   public:
+    using size_type  = std::size_t;
+    using real_type  = typename coordinate_traits<T>::real_type;
+    using point_type = BasicPoint<real_type>;
+
+    explicit BentleyOttmann(const std::vector<BasicSegment<T>> &segments)
+        : _n(segments.size()),
+          _status(Below{this}),
+          _where(segments.size()) {
+        _l.reserve(_n);
+        _r.reserve(_n);
+        for (size_type i = 0; i < _n; i++) {
+            point_type a(segments[i].start()), b(segments[i].end());
+            if (EventLess()(b, a)) std::swap(a, b);
+            _l.push_back(a);
+            _r.push_back(b);
+            _events[a].push_back(i);
+            _events[b];
+        }
+    }
+
+    template <class Callback>
+    void run(Callback &report) {
+        std::vector<size_type> through, inserted;
+        while (!_events.empty()) {
+            _p = std::begin(_events)->first;
+            // p を左端とする辺
+            const std::vector<size_type> upper =
+                std::move(std::begin(_events)->second);
+            _events.erase(std::begin(_events));
+            // p を通る辺は状態の中で連続している
+            through = upper;
+            for (auto it = _status.lower_bound(PROBE);
+                 it != std::end(_status) && eq(y_at(*it), _p.y());
+                 ++it) {
+                through.push_back(*it);
+            }
+            for (size_type a = 0; a < through.size(); a++) {
+                for (size_type b = a + 1; b < through.size(); b++) {
+                    size_type i = std::min(through[a], through[b]),
+                              j = std::max(through[a], through[b]);
+                    if (first_common_point(i, j)) report(i, j, _p);
+                }
+            }
+            // p を通る辺を取り除き，p より右に伸びるものを入れ直す
+            for (size_type k = upper.size(); k < through.size(); k++) {
+                _status.erase(_where[through[k]]);
+            }
+            inserted.clear();
+            for (size_type i : through) {
+                if (!same_event(_r[i], _p)) {
+                    _where[i] = _status.insert(i).first;
+                    inserted.push_back(i);
+                }
+            }
+            auto lo = _status.lower_bound(PROBE), hi = lo;
+            std::advance(hi, inserted.size());
+            if (lo != std::begin(_status)) find_event(*std::prev(lo), lo);
+            if (!inserted.empty()) find_event(*std::prev(hi), hi);
+        }
+    }
+
+   private:
+    // 走査点 p 自身を表す番号
+    static constexpr size_type PROBE = size_type(-1);
+
+    // 誤差を許した (x, y) の辞書順
+    struct EventLess {
+        bool operator()(const point_type &a, const point_type &b) const {
+            if (!eq(a.x(), b.x())) return a.x() < b.x();
+            return !eq(a.y(), b.y()) && a.y() < b.y();
+        }
+    };
+
+    struct Below {
+        const BentleyOttmann *self;
+        bool operator()(size_type a, size_type b) const {
+            return self->below(a, b);
+        }
+    };
+
+    using status_type = std::set<size_type, Below>;
+
+    static bool same_event(const point_type &a, const point_type &b) {
+        return !EventLess()(a, b) && !EventLess()(b, a);
+    }
+
+    bool vertical(size_type i) const {
+        return eq(_l[i].x(), _r[i].x());
+    }
+
+    // 走査線上での辺 i の y 座標
+    real_type y_at(size_type i) const {
+        if (i == PROBE) return _p.y();
+        if (vertical(i)) return std::clamp(_p.y(), _l[i].y(), _r[i].y());
+        real_type x = std::clamp(_p.x(), _l[i].x(), _r[i].x());
+        return _l[i].y() + (x - _l[i].x()) * (_r[i].y() - _l[i].y()) /
+                               (_r[i].x() - _l[i].x());
+    }
+
+    // 辺 a と辺 b の傾きの比較
+    int compare_slope(size_type a, size_type b) const {
+        bool va = vertical(a), vb = vertical(b);
+        if (va || vb) return int(va) - int(vb);
+        real_type sa = (_r[a].y() - _l[a].y()) / (_r[a].x() - _l[a].x()),
+                  sb = (_r[b].y() - _l[b].y()) / (_r[b].x() - _l[b].x());
+        return eq(sa, sb) ? 0 : sa < sb ? -1 : 1;
+    }
+
+    // 走査線のすぐ先で，辺 a が辺 b より下にあるか
+    bool below(size_type a, size_type b) const {
+        if (a == b) return false;
+        real_type ya = y_at(a), yb = y_at(b);
+        if (!eq(ya, yb)) return ya < yb;
+        if (a == PROBE || b == PROBE) return false;
+        int c = compare_slope(a, b);
+        if (c == 0) return a < b;
+        // 交点が p より先にあるなら，まだ交差する前の順序になる
+        return le(ya, _p.y()) ? c < 0 : c > 0;
+    }
+
+    bool colinear(size_type i, size_type j) const {
+        return turn(_l[i], _r[i], _l[j]) == 0 &&
+               turn(_l[i], _r[i], _r[j]) == 0;
+    }
+
+    // 左回りなら 1, 右回りなら -1, 一直線上なら 0
+    static int turn(const point_type &a,
+                    const point_type &b,
+                    const point_type &c) {
+        ClockWise t = ccw<Predicate>(a, b, c);
+        return t == COUNTER_CLOCKWISE ? 1 : t == CLOCKWISE ? -1 : 0;
+    }
+
+    // p が辺 i と辺 j の最も左の共有点か
+    bool first_common_point(size_type i, size_type j) const {
+        if (!colinear(i, j)) return true;
+        const point_type &m = EventLess()(_l[i], _l[j]) ? _l[j] : _l[i];
+        return same_event(m, _p);
+    }
+
+    // 隣り合った辺 i と *it の交点が p より先にあれば，イベントに加える
+    void find_event(size_type i, typename status_type::iterator it) {
+        if (it == std::end(_status)) return;
+        size_type j = *it;
+        if (colinear(i, j)) return;
+        const point_type &a = _l[i], &b = _r[i], &c = _l[j], &d = _r[j];
+        if (turn(a, b, c) * turn(a, b, d) > 0) return;
+        if (turn(c, d, a) * turn(c, d, b) > 0) return;
+        point_type da = b - a, dc = d - c,
+                   q = a + da * (cross(c - a, dc) / cross(da, dc));
+        if (EventLess()(_p, q)) _events[q];
+    }
+
+    const size_type _n;
+    // 各辺の左端と右端
+    std::vector<point_type> _l, _r;
+    // イベント点と，そこを左端とする辺
+    std::map<point_type, std::vector<size_type>, EventLess> _events;
+    // 走査線と交わる辺を下から順に並べたもの
+    status_type _status;
+    // 各辺の _status での位置
+    std::vector<typename status_type::iterator> _where;
+    // 走査点
+    point_type _p;
+};
+
+}  // namespace internal
+
+/**
+ * @brief report every intersecting pair of the segments.
+ * Each pair (i, j) with i < j is reported exactly once, with the
+ * leftmost common point of the two segments (the lowest one among the
+ * points with the same x-coordinate). Touching at endpoints counts as
+ * an intersection, and overlapping segments on the same line are
+ * reported at the leftmost point of the overlap.
+ * It takes O((n + k) log n) time for k pairs, and the pairs are passed
+ * to the callback as soon as they are found, so k is not limited by
+ * memory.
+ * @param segments Segment
+ * @param report called as report(i, j, p) for each pair
+ */
+template <class Predicate = EpsilonPredicate, class T, class Callback>
+void segment_intersections(const std::vector<BasicSegment<T>> &segments,
+                           Callback                          &&report) {
+    internal::BentleyOttmann<T, Predicate> sweep(segments);
+    sweep.run(report);
+}
+
+/**
+ * @brief list every intersecting pair of the segments.
+ * See segment_intersections with a callback.
+ * @return std::vector of (i, j, p)
+ */
+template <class Predicate = EpsilonPredicate, class T>
+std::vector<std::tuple<std::size_t,
+                       std::size_t,
+                       BasicPoint<typename coordinate_traits<T>::real_type>>>
+segment_intersections(const std::vector<BasicSegment<T>> &segments) {
+    using real_type = typename coordinate_traits<T>::real_type;
+    std::vector<std::tuple<std::size_t, std::size_t, BasicPoint<real_type>>>
+        ret;
+    segment_intersections<Predicate>(
+        segments,
+        [&ret](std::size_t i, std::size_t j, const BasicPoint<real_type> &p) {
+            ret.emplace_back(i, j, p);
+        });
+    return ret;
+}
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_SEGMENT_INTERSECTION_HPP_
@@ -0,0 +1,215 @@
+#ifndef GEOMETRY_SPATIAL_GRID_HPP_
+#define GEOMETRY_SPATIAL_GRID_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "config.hpp"
+#include "point.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief Uniform grid hash for points that move.
+ * The plane is divided into square cells, and the cells are hashed into
+ * about as many buckets as the points. rebuild sorts the points by
+ * bucket with counting sort in O(n) time, so the points of a bucket are
+ * contiguous in memory.
+ * update moves one point. If it stays in the same cell, it is written
+ * in place. Otherwise it is moved to a small overflow list of its new
+ * bucket, and the whole grid is rebuilt when the lists get long.
+ * Radius queries visit the cells overlapping the bounding square of the
+ * circle, so the cell size should be about the typical radius.
+ */
+template <class T>
+class BasicSpatialGrid {
+   public:
+    using value_type   = T;
+    using size_type    = std::size_t;
+    using point_type   = BasicPoint<T>;
+    using real_type    = typename coordinate_traits<T>::real_type;
+    using product_type = typename coordinate_traits<T>::product_type;
+
+    /**
+     * @param cell_size length of the sides of the cells
+     */
+    explicit BasicSpatialGrid(real_type cell_size) : _cell_size(cell_size) {
+        assert(cell_size > 0);
+    }
+
+    BasicSpatialGrid(real_type cell_size, const std::vector<point_type> &points)
+        : BasicSpatialGrid(cell_size) {
+        rebuild(points);
+    }
+
+    size_type size() const noexcept {
+        return _points.size();
+    }
+
+    // i 番目の点の現在の位置
+    const point_type &operator[](size_type i) const {
+        return _points[i];
+    }
+
+    /**
+     * @brief replace all the points in O(n) time.
+     */
+    void rebuild(const std::vector<point_type> &points) {
+        _points = points;
+        rebuild();
+    }
+
+    /**
+     * @brief move the i-th point to p.
+     */
+    void update(size_type i, const point_type &p) {
+        const cell_type c = cell(p);
+        _points[i]        = p;
+        if (_pos[i] != MOVED) {
+            if (_keys[_pos[i]] == c) {
+                _sorted[_pos[i]] = p;
+                return;
+            }
+            // 元の場所は使わない印をつける
+            _alive[_pos[i]] = false;
+        } else {
+            auto &list = _extra[_extra_bucket[i]];
+            list.erase(std::find(std::begin(list), std::end(list), i));
+            _moved--;
+        }
+        _pos[i]          = MOVED;
+        _extra_bucket[i] = bucket(c);
+        _extra[_extra_bucket[i]].push_back(i);
+        if (++_moved > std::max<size_type>(16, _points.size() / 8)) rebuild();
+    }
+
+    /**
+     * @brief call f(i) for each point i whose distance from q is at most r.
+     */
+    template <class Function>
+    void for_each_within(const point_type &q, real_type r, Function &&f) const {
+        if (_points.empty()) return;
+        const real_type r2 = r * r;
+        const cell_type lo = cell(q, -r), hi = cell(q, r);
+        for (std::int64_t x = lo.first; x <= hi.first; x++) {
+            for (std::int64_t y = lo.second; y <= hi.second; y++) {
+                const cell_type c(x, y);
+                const size_type b = bucket(c);
+                for (size_type k = _start[b]; k < _start[b + 1]; k++) {
+                    // 同じバケットに入る他のセルの点は除く
+                    if (_keys[k] != c || !_alive[k]) continue;
+                    if (le(real_type(norm(_sorted[k] - q)), r2)) f(_ids[k]);
+                }
+                for (size_type i : _extra[b]) {
+                    if (cell(_points[i]) != c) continue;
+                    if (le(real_type(norm(_points[i] - q)), r2)) f(i);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief list the points whose distance from q is at most r.
+     * @return indices of the points in unspecified order.
+     */
+    std::vector<size_type> within_radius(const point_type &q,
+                                         real_type         r) const {
+        std::vector<size_type> ret;
+        for_each_within(q, r, [&ret](size_type i) { ret.push_back(i); });
+        return ret;
+    }
+
+    /**
+     * @brief call f(i, j) with i < j for each pair of points whose
+     * distance is at most r.
+     */
+    template <class Function>
+    void for_each_pair_within(real_type r, Function &&f) const {
+        for (size_type i = 0; i < _points.size(); i++) {
+            for_each_within(_points[i], r, [&](size_type j) {
+                if (i < j) f(i, j);
+            });
+        }
+    }
+
+   private:
+    using cell_type = std::pair<std::int64_t, std::int64_t>;
+
+    // 溢れたリストにある点の _pos
+    static constexpr size_type MOVED = size_type(-1);
+
+    // 点 p を (d, d) だけずらした点を含むセル
+    cell_type cell(const point_type &p, real_type d = 0) const {
+        return cell_type(
+            std::int64_t(std::floor((real_type(p.x()) + d) / _cell_size)),
+            std::int64_t(std::floor((real_type(p.y()) + d) / _cell_size)));
+    }
+
+    size_type bucket(const cell_type &c) const {
+        std::uint64_t h = std::uint64_t(c.first) * 0x9E3779B97F4A7C15ull ^
+                          std::uint64_t(c.second) * 0xC2B2AE3D27D4EB4Full;
+        return size_type(h ^ (h >> 29)) & (_buckets - 1);
+    }
+
+    void rebuild() {
+        const size_type n = _points.size();
+        _buckets          = 1;
+        while (_buckets < n) _buckets *= 2;
+        // バケットごとの個数を数えて，その累積和の位置に並べる
+        std::vector<size_type> b(n);
+        _start.assign(_buckets + 1, 0);
+        for (size_type i = 0; i < n; i++) {
+            b[i] = bucket(cell(_points[i]));
+            _start[b[i] + 1]++;
+        }
+        for (size_type i = 0; i < _buckets; i++) _start[i + 1] += _start[i];
+        std::vector<size_type> next(std::begin(_start), std::end(_start) - 1);
+        _sorted.resize(n);
+        _ids.resize(n);
+        _keys.resize(n);
+        _pos.resize(n);
+        for (size_type i = 0; i < n; i++) {
+            size_type k = next[b[i]]++;
+            _sorted[k]  = _points[i];
+            _ids[k]     = i;
+            _keys[k]    = cell(_points[i]);
+            _pos[i]     = k;
+        }
+        _alive.assign(n, true);
+        _extra.assign(_buckets, {});
+        _extra_bucket.assign(n, 0);
+        _moved = 0;
+    }
+
+    real_type _cell_size;
+    size_type _buckets = 1;
+    // 元の順番の点
+    std::vector<point_type> _points;
+    // バケット b の点は _sorted[_start[b], _start[b + 1])
+    std::vector<size_type>  _start;
+    std::vector<point_type> _sorted;
+    std::vector<size_type>  _ids;
+    std::vector<cell_type>  _keys;
+    std::vector<bool>       _alive;
+    // 各点の _sorted での位置
+    std::vector<size_type> _pos;
+    // セルを移った点のバケットごとのリスト
+    std::vector<std::vector<size_type>> _extra;
+    std::vector<size_type>              _extra_bucket;
+    size_type                           _moved = 0;
+};
+
+using SpatialGrid = BasicSpatialGrid<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_SPATIAL_GRID_HPP_
@@ -1,8 +1,11 @@
 #ifndef GEOMETRY_TANGENT_HPP_
 #define GEOMETRY_TANGENT_HPP_
 
+#include <cmath>
+
 #include "circle.hpp"
 #include "config.hpp"
+#include "fixed_vector.hpp"
 #include "line.hpp"
 #include "point.hpp"
 
@@ -17,23 +20,28 @@ namespace geometry {
  * https://onlinejudge.u-aizu.ac.jp/courses/library/4/CGL/7/CGL_7_F
  * @param c Circle
  * @param p Point
- * @return std::vector<Point>
+ * @return FixedVector<Point, 2>
  */
-std::vector<Point> tangent(const Circle &c, const Point &p) {
+template <class T>
+FixedVector<BasicPoint<T>, 2> tangent(const BasicCircle<T> &c,
+                                      const BasicPoint<T>  &p) {
     if (c.on_object(p)) {
         return {p};
     } else if (c.inside(p)) {
         return {};
     } else {
+        using internal::mul_add;
+        using P     = BasicPoint<T>;
         auto q      = p - c.center();
         auto nrm    = norm(q);
         auto r      = c.radius();
-        auto dst    = std::sqrt(-fma(c.radius(), c.radius(), -nrm));
+        auto dst    = std::sqrt(-mul_add(c.radius(), c.radius(), -nrm));
         auto center = c.center();
-        return {Point(fma((fma(q.x(), r, q.y() * dst)), r / nrm, center.x()),
-                      fma((fma(q.y(), r, -q.x() * dst)), r / nrm, center.y())),
-                Point(fma((fma(q.x(), r, -q.y() * dst)), r / nrm, center.x()),
-                      fma((fma(q.y(), r, q.x() * dst)), r / nrm, center.y()))};
+        auto k      = r / nrm;
+        return {P(mul_add(mul_add(q.x(), r, q.y() * dst), k, center.x()),
+                  mul_add(mul_add(q.y(), r, -q.x() * dst), k, center.y())),
+                P(mul_add(mul_add(q.x(), r, -q.y() * dst), k, center.x()),
+                  mul_add(mul_add(q.y(), r, q.x() * dst), k, center.y()))};
     }
 }
 
@@ -0,0 +1,243 @@
+#ifndef GEOMETRY_VORONOI_HPP_
+#define GEOMETRY_VORONOI_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "circle.hpp"
+#include "config.hpp"
+#include "delaunay.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+namespace sapphre15 {
+
+namespace geometry {
+
+/**
+ * @brief calculate the circumcenters of all the triangles.
+ * @return the circumcenter of the triangle t at index t
+ */
+template <class T, class Predicate>
+std::vector<BasicPoint<typename coordinate_traits<T>::real_type>>
+circumcenters(const std::vector<BasicPoint<T>>  &points,
+              const BasicDelaunay<T, Predicate> &delaunay) {
+    using R = typename coordinate_traits<T>::real_type;
+    std::vector<BasicPoint<R>> ret(delaunay.size());
+    for (std::size_t t = 0; t < delaunay.size(); t++) {
+        auto v = delaunay.triangle(t);
+        ret[t] = BasicCircle<R>(BasicPoint<R>(points[v[0]]),
+                                BasicPoint<R>(points[v[1]]),
+                                BasicPoint<R>(points[v[2]]))
+                     .center();
+    }
+    return ret;
+}
+
+/**
+ * @brief Voronoi diagram clipped to an axis-parallel box.
+ * The cells are the duals of the Delaunay triangulation. The cell of a
+ * site inside the hull is the polygon of the circumcenters of the
+ * triangles around it, which is then clipped to the box. The cell of a
+ * site on the hull is unbounded, so it is made from the box by clipping
+ * with the bisectors between the site and its neighbors.
+ * All the cells are stored in one array of vertices. The vertices of
+ * the cell i are vertices()[offsets()[i], offsets()[i + 1]) in
+ * counterclockwise order, and the range is empty if the cell does not
+ * meet the box or the site is a duplicate that the triangulation did not
+ * use.
+ */
+template <class T>
+class BasicVoronoi {
+   public:
+    using value_type  = T;
+    using size_type   = std::size_t;
+    using point_type  = BasicPoint<T>;
+    using real_type   = typename coordinate_traits<T>::real_type;
+    using vertex_type = BasicPoint<real_type>;
+
+    /**
+     * @param points sites
+     * @param delaunay Delaunay triangulation of the sites
+     * @param lo lower left corner of the box
+     * @param hi upper right corner of the box
+     */
+    template <class Predicate>
+    BasicVoronoi(const std::vector<point_type>     &points,
+                 const BasicDelaunay<T, Predicate> &delaunay,
+                 const vertex_type                 &lo,
+                 const vertex_type                 &hi)
+        : _offsets(points.size() + 1, 0) {
+        assert(lo.x() <= hi.x() && lo.y() <= hi.y());
+        const std::vector<size_type> &tri  = delaunay.triangles();
+        const std::vector<size_type> &half = delaunay.halfedges();
+        const size_type               NONE = delaunay.NONE;
+        const std::vector<vertex_type> center =
+            circumcenters(points, delaunay);
+        // 各点から出る半辺。凸包上の点は凸包の辺を選ぶ
+        std::vector<size_type> out(points.size(), NONE);
+        std::vector<bool>      hull(points.size(), false);
+        for (size_type e = 0; e < tri.size(); e++) {
+            if (half[e] == NONE) {
+                hull[tri[e]] = true;
+                out[tri[e]]  = e;
+            } else if (out[tri[e]] == NONE) {
+                out[tri[e]] = e;
+            }
+        }
+        // 三角形分割がないときは全ての点が一直線上にあるので，直線に沿って
+        // 隣り合う点との二等分線で切る
+        std::vector<size_type> line, rank(points.size(), NONE);
+        if (tri.empty()) {
+            line = line_order<Predicate>(points);
+            for (size_type k = 0; k < line.size(); k++) rank[line[k]] = k;
+        }
+        auto at = [&points](size_type i) { return vertex_type(points[i]); };
+        for (size_type i = 0; i < points.size(); i++) {
+            const vertex_type site = at(i);
+            _buf.clear();
+            if (rank[i] != NONE) {
+                set_box(lo, hi);
+                if (rank[i] > 0) clip_bisector(site, at(line[rank[i] - 1]));
+                if (rank[i] + 1 < line.size()) {
+                    clip_bisector(site, at(line[rank[i] + 1]));
+                }
+            } else if (out[i] != NONE && hull[i]) {
+                set_box(lo, hi);
+                // 凸包の辺から反時計回りに隣の点を順に見る
+                size_type e = out[i];
+                clip_bisector(site, at(tri[delaunay.next(e)]));
+                while (half[delaunay.prev(e)] != NONE) {
+                    e = half[delaunay.prev(e)];
+                    clip_bisector(site, at(tri[delaunay.next(e)]));
+                }
+                clip_bisector(site, at(tri[delaunay.prev(e)]));
+            } else if (out[i] != NONE) {
+                size_type e = out[i];
+                do {
+                    _buf.push_back(center[e / 3]);
+                    e = half[delaunay.prev(e)];
+                } while (e != out[i]);
+                clip_box(lo, hi);
+            }
+            remove_duplicates();
+            _vertices.insert(
+                std::end(_vertices), std::begin(_buf), std::end(_buf));
+            _offsets[i + 1] = _vertices.size();
+        }
+    }
+
+    /**
+     * @brief build the Delaunay triangulation and its Voronoi diagram.
+     */
+    BasicVoronoi(const std::vector<point_type> &points,
+                 const vertex_type             &lo,
+                 const vertex_type             &hi)
+        : BasicVoronoi(points, BasicDelaunay<T>(points), lo, hi) {
+    }
+
+    // 点の個数
+    size_type size() const noexcept {
+        return _offsets.size() - 1;
+    }
+
+    const std::vector<vertex_type> &vertices() const noexcept {
+        return _vertices;
+    }
+
+    const std::vector<size_type> &offsets() const noexcept {
+        return _offsets;
+    }
+
+    /**
+     * @brief the cell of the i-th site as a Polygon.
+     * @return std::nullopt if the cell has less than three vertices.
+     */
+    std::optional<BasicPolygon<real_type>> polygon(size_type i) const {
+        if (_offsets[i + 1] - _offsets[i] < 3) return std::nullopt;
+        return BasicPolygon<real_type>(std::vector<vertex_type>(
+            std::begin(_vertices) + _offsets[i],
+            std::begin(_vertices) + _offsets[i + 1]));
+    }
+
+   private:
+    // 一直線上の点を直線に沿って並べ，重複する点を除く
+    template <class Predicate>
+    static std::vector<size_type> line_order(
+        const std::vector<point_type> &points) {
+        std::vector<size_type> ret(points.size());
+        std::iota(std::begin(ret), std::end(ret), 0);
+        std::sort(
+            std::begin(ret), std::end(ret), [&](size_type a, size_type b) {
+                return std::make_pair(points[a].x(), points[a].y()) <
+                       std::make_pair(points[b].x(), points[b].y());
+            });
+        ret.erase(std::unique(std::begin(ret),
+                              std::end(ret),
+                              [&](size_type a, size_type b) {
+                                  return Predicate::equal(points[a],
+                                                          points[b]);
+                              }),
+                  std::end(ret));
+        return ret;
+    }
+
+    void set_box(const vertex_type &lo, const vertex_type &hi) {
+        _buf = {lo,
+                vertex_type(hi.x(), lo.y()),
+                hi,
+                vertex_type(lo.x(), hi.y())};
+    }
+
+    // dot(q - m, d) <= 0 となる部分を残す
+    void clip_half_plane(const vertex_type &m, const vertex_type &d) {
+        _tmp.clear();
+        for (size_type k = 0; k < _buf.size(); k++) {
+            const vertex_type &a = _buf[k], &b = _buf[(k + 1) % _buf.size()];
+            real_type sa = dot(a - m, d), sb = dot(b - m, d);
+            if (sa <= 0) _tmp.push_back(a);
+            if ((sa < 0 && sb > 0) || (sa > 0 && sb < 0)) {
+                _tmp.push_back(a + (b - a) * (sa / (sa - sb)));
+            }
+        }
+        std::swap(_buf, _tmp);
+    }
+
+    // site と neighbor の垂直二等分線で site の側を残す
+    void clip_bisector(const vertex_type &site, const vertex_type &neighbor) {
+        clip_half_plane((site + neighbor) / 2, neighbor - site);
+    }
+
+    void clip_box(const vertex_type &lo, const vertex_type &hi) {
+        clip_half_plane(lo, vertex_type(-1, 0));
+        clip_half_plane(lo, vertex_type(0, -1));
+        clip_half_plane(hi, vertex_type(1, 0));
+        clip_half_plane(hi, vertex_type(0, 1));
+    }
+
+    // 同一円周上の点による重複した頂点を除く
+    void remove_duplicates() {
+        _buf.erase(std::unique(std::begin(_buf), std::end(_buf)),
+                   std::end(_buf));
+        while (_buf.size() > 1 && _buf.front() == _buf.back()) _buf.pop_back();
+        if (_buf.size() < 3) _buf.clear();
+    }
+
+    std::vector<vertex_type> _vertices;
+    std::vector<size_type>   _offsets;
+    // 作りかけの領域
+    std::vector<vertex_type> _buf, _tmp;
+};
+
+using Voronoi = BasicVoronoi<Real>;
+
+}  // namespace geometry
+
+}  // namespace sapphre15
+
+#endif  // GEOMETRY_VORONOI_HPP_
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <affine_transform.hpp>
+#include <circle.hpp>
+#include <config.hpp>
+#include <line.hpp>
+#include <point.hpp>
+#include <point_buffer.hpp>
+#include <polygon.hpp>
+#include <random>
+#include <ray.hpp>
+#include <segment.hpp>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+void expect_near(const Point &p, const Point &q) {
+    EXPECT_NEAR(p.x(), q.x(), 1e-9);
+    EXPECT_NEAR(p.y(), q.y(), 1e-9);
+}
+
+}  // namespace
+
+TEST(affineTransformTest, pointTest) {
+    Point p(3.0, -2.0);
+    expect_near(AffineTransform()(p), p);
+    expect_near(AffineTransform::translation(Point(1.0, 2.0))(p),
+                Point(4.0, 0.0));
+    expect_near(AffineTransform::scaling(2.0, -1.0)(p), Point(6.0, 2.0));
+    expect_near(AffineTransform::rotation(PI / 2)(p), Point(2.0, 3.0));
+    expect_near(AffineTransform::rotation(PI, Point(1.0, 1.0))(p),
+                Point(-1.0, 4.0));
+    // rotate と一致する
+    for (Real theta : {0.3, -1.2, 2.5, 10.0}) {
+        expect_near(AffineTransform::rotation(theta)(p), rotate(p, theta));
+    }
+}
+
+TEST(affineTransformTest, composeTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-10.0, 10.0);
+    for (int k = 0; k < 100; k++) {
+        AffineTransform f(
+            unit(rng), unit(rng), unit(rng), unit(rng), unit(rng), unit(rng));
+        Point           c(unit(rng), unit(rng)), p(unit(rng), unit(rng));
+        AffineTransform g = AffineTransform::rotation(unit(rng), c);
+        expect_near((f * g)(p), f(g(p)));
+        AffineTransform h = f;
+        h *= g;
+        expect_near(h(p), f(g(p)));
+        if (abs(f.determinant()) > 1e-3) {
+            expect_near(f.inverse()(f(p)), p);
+            expect_near(f(f.inverse()(p)), p);
+        }
+        EXPECT_NEAR((f * g).determinant(),
+                    f.determinant() * g.determinant(),
+                    1e-6);
+    }
+}
+
+TEST(affineTransformTest, shapeTest) {
+    AffineTransform f = AffineTransform::translation(Point(1.0, 0.0)) *
+                        AffineTransform::rotation(PI / 2);
+    Line    l(Point(0.0, 0.0), Point(1.0, 0.0));
+    Segment s(Point(1.0, 0.0), Point(2.0, 0.0));
+    Ray     r(Point(0.0, 1.0), Point(1.0, 1.0));
+    Line    fl = f(l);
+    EXPECT_TRUE(fl.on_object(Point(1.0, 5.0)));
+    EXPECT_FALSE(fl.on_object(Point(0.0, 5.0)));
+    auto [a, b] = f(s).end_points();
+    expect_near(a, Point(1.0, 1.0));
+    expect_near(b, Point(1.0, 2.0));
+    Ray fr = f(r);
+    expect_near(fr.source(), Point(0.0, 0.0));
+    EXPECT_TRUE(fr.on_object(Point(0.0, 3.0)));
+    EXPECT_FALSE(fr.on_object(Point(0.0, -3.0)));
+
+    AffineTransform g = AffineTransform::scaling(2.0) * f;
+    EXPECT_TRUE(g.is_similarity());
+    Circle c = g(Circle(Point(1.0, 1.0), 1.5));
+    expect_near(c.center(), Point(0.0, 2.0));
+    EXPECT_NEAR(c.radius(), 3.0, 1e-9);
+    EXPECT_FALSE(AffineTransform::scaling(2.0, 1.0).is_similarity());
+    // 鏡映も相似変換
+    EXPECT_TRUE(AffineTransform::scaling(-3.0, 3.0).is_similarity());
+    EXPECT_NEAR(AffineTransform::scaling(-3.0, 3.0)(Circle(Point(), 1.0))
+                    .radius(),
+                3.0,
+                1e-9);
+
+    // 鏡映でも反時計回りが保たれる
+    Polygon pl = {Point(0.0, 0.0), Point(2.0, 0.0), Point(0.0, 1.0)};
+    Polygon q  = AffineTransform::scaling(-2.0, 1.0)(pl);
+    EXPECT_NEAR(q.area(), 2.0, 1e-9);
+    EXPECT_TRUE(q.on_object(Point(-4.0, 0.0)));
+    EXPECT_TRUE(q.inside(Point(-1.0, 0.25)));
+}
+
+TEST(affineTransformTest, pointBufferTest) {
+    mt19937                     rng(1);
+    uniform_real_distribution<> unit(-100.0, 100.0);
+    vector<Point>               p(1000);
+    for (Point &q : p) q = Point(unit(rng), unit(rng));
+    AffineTransform f = AffineTransform::rotation(0.7, Point(3.0, -1.0)) *
+                        AffineTransform::scaling(1.5, -0.5);
+    PointBuffer buf(p), out;
+    f(buf, out);
+    ASSERT_EQ(out.size(), p.size());
+    for (size_t i = 0; i < p.size(); i++) expect_near(out[i], f(p[i]));
+    f(buf);
+    for (size_t i = 0; i < p.size(); i++) expect_near(buf[i], f(p[i]));
+}
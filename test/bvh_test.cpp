@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <bvh.hpp>
+#include <circle.hpp>
+#include <config.hpp>
+#include <polygon.hpp>
+#include <random>
+#include <segment.hpp>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 線分，円，三角形を混ぜて n 個生成する
+vector<Shape> random_shapes(size_t n, unsigned seed) {
+    mt19937                     rng(seed);
+    uniform_real_distribution<> unit(0.0, 100.0), len(-5.0, 5.0), r(0.1, 3.0);
+    vector<Shape>               ret;
+    for (size_t i = 0; i < n; i++) {
+        Point p(unit(rng), unit(rng));
+        switch (i % 3) {
+            case 0:
+                ret.emplace_back(Segment(p, p + Point(len(rng), len(rng))));
+                break;
+            case 1:
+                ret.emplace_back(Circle(p, r(rng)));
+                break;
+            default:
+                ret.emplace_back(Polygon({p,
+                                          p + Point(len(rng), len(rng)),
+                                          p + Point(len(rng), len(rng))}));
+                break;
+        }
+    }
+    return ret;
+}
+
+}  // namespace
+
+TEST(bvhTest, queryTest) {
+    vector<Shape> s = {
+        Segment(Point(0.0, 0.0), Point(4.0, 4.0)),
+        Circle(Point(10.0, 0.0), 2.0),
+        Polygon({Point(0.0, 10.0), Point(4.0, 10.0), Point(4.0, 14.0)}),
+        Circle(Point(20.0, 20.0), 1.0),
+    };
+    Bvh bvh(s);
+    EXPECT_EQ(bvh.size(), 4u);
+    auto q1 = bvh.query(Segment(Point(0.0, 4.0), Point(12.0, 0.0)));
+    sort(begin(q1), end(q1));
+    EXPECT_EQ(q1, vector<size_t>({0, 1}));
+    // 多角形の内部に含まれる円
+    EXPECT_EQ(bvh.query(Circle(Point(3.0, 11.0), 0.1)), vector<size_t>({2}));
+    // 円の内部に含まれる線分
+    EXPECT_EQ(bvh.query(Segment(Point(10.0, 0.0), Point(10.5, 0.5))),
+              vector<size_t>({1}));
+    EXPECT_TRUE(bvh.query(Circle(Point(20.0, 17.0), 1.5)).empty());
+    EXPECT_EQ(bvh.query(Shape(Circle(Point(20.0, 17.0), 2.0))),
+              vector<size_t>({3}));
+    EXPECT_TRUE(bvh.intersecting_pairs().empty());
+}
+
+TEST(bvhTest, randomTest) {
+    for (size_t n : {1, 5, 50, 600}) {
+        vector<Shape> s = random_shapes(n, n), q = random_shapes(60, 0);
+        Bvh           bvh(s);
+        for (const Shape &r : q) {
+            vector<size_t> expected;
+            for (size_t i = 0; i < n; i++) {
+                if (internal::overlap(s[i], r)) expected.push_back(i);
+            }
+            auto res = bvh.query(r);
+            sort(begin(res), end(res));
+            EXPECT_EQ(res, expected);
+        }
+        vector<pair<size_t, size_t>> expected;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = i + 1; j < n; j++) {
+                if (internal::overlap(s[i], s[j])) expected.emplace_back(i, j);
+            }
+        }
+        auto res = bvh.intersecting_pairs();
+        sort(begin(res), end(res));
+        EXPECT_EQ(res, expected);
+    }
+}
+
+TEST(bvhTest, sameCenterTest) {
+    // 中心が一致する図形ばかりでも分割できる
+    vector<Shape> s;
+    for (int i = 1; i <= 20; i++) s.emplace_back(Circle(Point(0.0, 0.0), i));
+    Bvh bvh(s);
+    EXPECT_EQ(bvh.intersecting_pairs().size(), 190u);
+    EXPECT_EQ(bvh.query(Segment(Point(0.0, 0.0), Point(0.5, 0.0))).size(),
+              20u);
+}
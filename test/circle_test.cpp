@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <circle.hpp>
+#include <random>
+#include <vector>
 
 using namespace sapphre15::geometry;
 
@@ -77,4 +79,63 @@ TEST(circleTest, incircleTest) {
     EXPECT_DOUBLE_EQ(c1.radius(), 1.0);
     EXPECT_TRUE(c2.center() == Point(-4.0, 6.0));
     EXPECT_DOUBLE_EQ(c2.radius(), sqrt(65.0));
-}
\ No newline at end of file
+}
+
+TEST(circleTest, diameterCircleTest) {
+    Circle c = diameter_circle(Point(1.0, 2.0), Point(7.0, 10.0));
+    EXPECT_TRUE(c.center() == Point(4.0, 6.0));
+    EXPECT_DOUBLE_EQ(c.radius(), 5.0);
+    Circle d = diameter_circle(BasicPoint<int>(0, 0), BasicPoint<int>(1, 1));
+    EXPECT_TRUE(d.center() == Point(0.5, 0.5));
+}
+
+TEST(circleTest, minEnclosingCircleTest) {
+    // 1点，重複する点，一直線上の点
+    Circle c1 = min_enclosing_circle(std::vector<Point>{Point(3.0, 4.0)});
+    EXPECT_TRUE(c1.center() == Point(3.0, 4.0));
+    EXPECT_DOUBLE_EQ(c1.radius(), 0.0);
+    Circle c2 = min_enclosing_circle(
+        std::vector<Point>{Point(1.0, 1.0), Point(1.0, 1.0), Point(3.0, 1.0)});
+    EXPECT_TRUE(c2.center() == Point(2.0, 1.0));
+    EXPECT_DOUBLE_EQ(c2.radius(), 1.0);
+    std::vector<BasicPoint<int>> line;
+    for (int i = 0; i < 50; i++) line.emplace_back(2 * i - 30, i);
+    for (std::uint32_t seed = 0; seed < 10; seed++) {
+        Circle c3 = min_enclosing_circle(line, seed);
+        EXPECT_TRUE(c3.center() == Point(19.0, 24.5));
+        EXPECT_NEAR(c3.radius(), std::sqrt(12005.0) / 2, 1e-9);
+    }
+    // 鈍角三角形では最も長い辺が直径になる
+    Circle c4 = min_enclosing_circle(
+        std::vector<Point>{Point(0.0, 0.0), Point(4.0, 0.0), Point(2.0, 1.0)});
+    EXPECT_TRUE(c4.center() == Point(2.0, 0.0));
+    EXPECT_DOUBLE_EQ(c4.radius(), 2.0);
+}
+
+TEST(circleTest, minEnclosingCircleRandomTest) {
+    std::mt19937                     rng(0);
+    std::uniform_real_distribution<> unit(-100.0, 100.0);
+    for (int t = 0; t < 20; t++) {
+        std::vector<Point> p(30);
+        for (Point &q : p) q = Point(unit(rng), unit(rng));
+        Circle c = min_enclosing_circle(p, t);
+        for (const Point &q : p) EXPECT_TRUE(c.inside(q));
+        // 2点または3点で決まる全ての円のうち，全体を含む最小のもの
+        Real best = 1e18;
+        auto update = [&](const Circle &d) {
+            for (const Point &q : p) {
+                if (!d.inside(q)) return;
+            }
+            best = std::min(best, d.radius());
+        };
+        for (size_t i = 0; i < p.size(); i++) {
+            for (size_t j = i + 1; j < p.size(); j++) {
+                update(diameter_circle(p[i], p[j]));
+                for (size_t k = j + 1; k < p.size(); k++) {
+                    update(Circle(p[i], p[j], p[k]));
+                }
+            }
+        }
+        EXPECT_NEAR(c.radius(), best, 1e-6);
+    }
+}
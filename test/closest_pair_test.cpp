@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <closest_pair.hpp>
+#include <config.hpp>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 全ての組の距離の2乗の最小値
+template <class T>
+typename coordinate_traits<T>::product_type brute_force(
+    const vector<BasicPoint<T>> &p) {
+    auto ret = norm(p[0] - p[1]);
+    for (size_t i = 0; i < p.size(); i++) {
+        for (size_t j = i + 1; j < p.size(); j++) {
+            ret = min(ret, norm(p[i] - p[j]));
+        }
+    }
+    return ret;
+}
+
+}  // namespace
+
+TEST(closestPairTest, sampleTest) {
+    // CGL_5_A の入力例
+    vector<Point> p1 = {Point(0.0, 0.0), Point(1.0, 0.0)},
+                  p2 = {Point(0.0, 0.0), Point(2.0, 0.0), Point(1.0, 1.0)};
+    auto          r1 = closest_pair(p1), r2 = closest_pair(p2);
+    EXPECT_EQ(get<0>(r1), 0u);
+    EXPECT_EQ(get<1>(r1), 1u);
+    EXPECT_DOUBLE_EQ(get<2>(r1), 1.0);
+    EXPECT_LT(get<0>(r2), get<1>(r2));
+    EXPECT_EQ(get<0>(r2) + get<1>(r2), 2u);
+    EXPECT_DOUBLE_EQ(get<2>(r2), 2.0);
+}
+
+TEST(closestPairTest, randomTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-100.0, 100.0);
+    for (size_t n : {2, 3, 5, 100, 1000}) {
+        vector<Point> p(n);
+        for (Point &q : p) q = Point(unit(rng), unit(rng));
+        auto res = closest_pair(p);
+        EXPECT_LT(get<0>(res), get<1>(res));
+        EXPECT_DOUBLE_EQ(get<2>(res), norm(p[get<0>(res)] - p[get<1>(res)]));
+        EXPECT_DOUBLE_EQ(get<2>(res), brute_force(p));
+    }
+}
+
+TEST(closestPairTest, integerTest) {
+    // 重複や一直線上の点を多く含む整数座標
+    using PointI = BasicPoint<int>;
+    mt19937                    rng(1);
+    uniform_int_distribution<> coord(-1000, 1000), small(0, 3);
+    vector<PointI>             p(2000);
+    for (PointI &q : p) q = PointI(coord(rng), small(rng) * 1000);
+    auto res = closest_pair(p);
+    EXPECT_EQ(get<2>(res), brute_force(p));
+    p.emplace_back(p[10]);
+    EXPECT_EQ(get<2>(closest_pair(p)), 0);
+}
+
+TEST(closestPairTest, parallelTest) {
+    mt19937                     rng(2);
+    uniform_real_distribution<> unit(0.0, 1e6);
+    vector<Point>               p(100000);
+    for (Point &q : p) q = Point(unit(rng), unit(rng));
+    auto seq = closest_pair(p), par = closest_pair(p, 4);
+    EXPECT_DOUBLE_EQ(get<2>(seq), get<2>(par));
+    EXPECT_DOUBLE_EQ(get<2>(par), norm(p[get<0>(par)] - p[get<1>(par)]));
+}
@@ -31,4 +31,26 @@ TEST(eq_test, neq_case) {
     EXPECT_FALSE(eq(0.0000001, 0.0));
     EXPECT_FALSE(eq(10000000.0, 10000001.0));
     EXPECT_FALSE(eq(-100000, -100001));
-}
\ No newline at end of file
+}
+
+TEST(coordinateTraitsTest, floatingTest) {
+    using FT = coordinate_traits<float>;
+    EXPECT_FALSE(FT::is_exact);
+    EXPECT_EQ(FT::sgn(1e-6f), 0);
+    EXPECT_EQ(FT::sgn(1e-4f), 1);
+    EXPECT_TRUE(FT::eq(1.0f, 1.000001f));
+    EXPECT_TRUE((std::is_same<FT::real_type, float>::value));
+    EXPECT_EQ(coordinate_traits<Real>::eps, EPS);
+}
+
+TEST(coordinateTraitsTest, integralTest) {
+    using IT = coordinate_traits<long long>;
+    EXPECT_TRUE(IT::is_exact);
+    EXPECT_EQ(sgn(1LL), 1);
+    EXPECT_EQ(sgn(0LL), 0);
+    EXPECT_EQ(sgn(-1LL), -1);
+    EXPECT_TRUE(eq(1000000000000LL, 1000000000000LL));
+    EXPECT_FALSE(eq(1000000000000LL, 1000000000001LL));
+    EXPECT_TRUE(le(-3LL, -3LL));
+    EXPECT_TRUE((std::is_same<IT::real_type, Real>::value));
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <config.hpp>
+#include <convex_cut.hpp>
+#include <line.hpp>
+#include <polygon.hpp>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+TEST(convexCutTest, sampleTest) {
+    // CGL_4_C の入力例
+    Polygon pl = {
+        Point(1.0, 1.0), Point(4.0, 1.0), Point(4.0, 3.0), Point(1.0, 3.0)};
+    auto left = convex_cut(pl, Line(Point(2.0, 0.0), Point(2.0, 4.0)));
+    ASSERT_TRUE(left);
+    EXPECT_DOUBLE_EQ(left->area(), 2.0);
+    auto right = convex_cut(pl, Line(Point(2.0, 4.0), Point(2.0, 0.0)));
+    ASSERT_TRUE(right);
+    EXPECT_DOUBLE_EQ(right->area(), 4.0);
+}
+
+TEST(convexCutTest, degenerateTest) {
+    Polygon pl = {Point(0.0, 0.0), Point(2.0, 0.0), Point(0.0, 2.0)};
+    // 全体が左側，全体が右側，辺の上を通る直線
+    auto all = convex_cut(pl, Line(Point(-1.0, -1.0), Point(5.0, -1.0)));
+    ASSERT_TRUE(all);
+    EXPECT_DOUBLE_EQ(all->area(), 2.0);
+    EXPECT_EQ(all->size(), 3u);
+    EXPECT_FALSE(convex_cut(pl, Line(Point(5.0, -1.0), Point(-1.0, -1.0))));
+    EXPECT_FALSE(convex_cut(pl, Line(Point(1.0, 0.0), Point(0.0, 0.0))));
+    auto same = convex_cut(pl, Line(Point(0.0, 0.0), Point(1.0, 0.0)));
+    ASSERT_TRUE(same);
+    EXPECT_EQ(same->size(), 3u);
+    // 頂点を通る直線
+    auto half = convex_cut(pl, Line(Point(0.0, 0.0), Point(1.0, 1.0)));
+    ASSERT_TRUE(half);
+    EXPECT_DOUBLE_EQ(half->area(), 1.0);
+    EXPECT_EQ(half->size(), 3u);
+}
+
+TEST(convexCutTest, randomTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-10.0, 10.0);
+    Polygon                     pl = {Point(-5.0, -4.0),
+                                      Point(3.0, -6.0),
+                                      Point(7.0, 0.0),
+                                      Point(4.0, 5.0),
+                                      Point(-3.0, 4.0)};
+    for (int t = 0; t < 200; t++) {
+        Point a(unit(rng), unit(rng)), b(unit(rng), unit(rng));
+        auto  left  = convex_cut(pl, Line(a, b));
+        auto  right = convex_cut(pl, Line(b, a));
+        Real  sum   = 0;
+        if (left) sum += left->area();
+        if (right) sum += right->area();
+        EXPECT_NEAR(sum, pl.area(), 1e-9);
+        if (left) {
+            EXPECT_TRUE(left->is_convex());
+            for (size_t i = 0; i < left->size(); i++) {
+                EXPECT_NE(ccw(a, b, (*left)[i]), CLOCKWISE);
+            }
+        }
+    }
+}
+
+TEST(convexCutTest, bufferTest) {
+    // 原点を含む半平面で何度も切っていく
+    mt19937                     rng(1);
+    uniform_real_distribution<> angle(0.0, 2 * PI), dist(1.0, 5.0);
+    vector<Point>               region = {Point(-10.0, -10.0),
+                                          Point(10.0, -10.0),
+                                          Point(10.0, 10.0),
+                                          Point(-10.0, 10.0)},
+                  buf;
+    vector<Line> lines;
+    for (int t = 0; t < 2000; t++) {
+        Point n = Point::polar(angle(rng)), p = n * dist(rng);
+        lines.emplace_back(p, p + rotate(n, PI / 2));
+        convex_cut(region, lines.back(), buf);
+        swap(region, buf);
+        ASSERT_GE(region.size(), 3u);
+    }
+    EXPECT_LE(region.size(), lines.size() + 4);
+    Polygon pl(region);
+    EXPECT_TRUE(pl.is_convex());
+    EXPECT_TRUE(pl.inside(Point(0.0, 0.0)));
+    for (const Line &l : lines) {
+        auto [a, b] = l.points();
+        for (const Point &q : region) EXPECT_NE(ccw(a, b, q), CLOCKWISE);
+    }
+}
+
+TEST(convexCutTest, integerTest) {
+    // 交点は切り捨てではなく最も近い整数に丸める
+    using PointI = BasicPoint<int>;
+    vector<PointI> square = {
+        PointI(0, 0), PointI(10, 0), PointI(10, 10), PointI(0, 10)},
+                   out;
+    // 直線 y = 7x / 3 - 2 は (6/7, 0) と (36/7, 10) を通る
+    convex_cut(square, BasicLine<int>(PointI(0, -2), PointI(3, 5)), out);
+    EXPECT_EQ(out,
+              vector<PointI>(
+                  {PointI(0, 0), PointI(1, 0), PointI(5, 10), PointI(0, 10)}));
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <config.hpp>
+#include <convex_hull.hpp>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+TEST(convexHullTest, squareTest) {
+    vector<Point> p = {Point(2.0, 2.0),
+                       Point(0.0, 0.0),
+                       Point(1.0, 1.0),
+                       Point(0.0, 2.0),
+                       Point(2.0, 0.0),
+                       Point(1.0, 0.0),
+                       Point(0.5, 1.5),
+                       Point(2.0, 0.0)};
+    vector<Point> h1 = convex_hull_points(p), h2 = convex_hull_points(p, true);
+    EXPECT_EQ(h1, vector<Point>({Point(0.0, 0.0),
+                                 Point(2.0, 0.0),
+                                 Point(2.0, 2.0),
+                                 Point(0.0, 2.0)}));
+    EXPECT_EQ(h2, vector<Point>({Point(0.0, 0.0),
+                                 Point(1.0, 0.0),
+                                 Point(2.0, 0.0),
+                                 Point(2.0, 2.0),
+                                 Point(0.0, 2.0)}));
+    Polygon pl = convex_hull(p);
+    EXPECT_EQ(pl.size(), 4);
+    EXPECT_DOUBLE_EQ(pl.area(), 4.0);
+    EXPECT_TRUE(pl.is_convex());
+}
+
+TEST(convexHullTest, colinearTest) {
+    vector<Point> p = {
+        Point(3.0, 3.0), Point(1.0, 1.0), Point(0.0, 0.0), Point(2.0, 2.0)};
+    EXPECT_EQ(convex_hull_points(p),
+              vector<Point>({Point(0.0, 0.0), Point(3.0, 3.0)}));
+    EXPECT_EQ(convex_hull_points(p, true),
+              vector<Point>({Point(0.0, 0.0),
+                             Point(1.0, 1.0),
+                             Point(2.0, 2.0),
+                             Point(3.0, 3.0)}));
+    EXPECT_EQ(convex_hull_points(vector<Point>({Point(1.0, 2.0)})).size(), 1);
+    EXPECT_TRUE(convex_hull_points(vector<Point>()).empty());
+}
+
+TEST(convexHullTest, parallelTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-1.0, 1.0);
+    vector<Point>               p(100000);
+    for (Point &q : p) q = Point(unit(rng), unit(rng));
+    // 境界上の点を加える
+    for (int i = 0; i <= 100; i++) p.emplace_back(-1.0 + 0.02 * i, -1.0);
+    EXPECT_EQ(convex_hull_points(p, false, 4), convex_hull_points(p, false));
+    EXPECT_EQ(convex_hull_points(p, true, 4), convex_hull_points(p, true));
+    EXPECT_GE(convex_hull_points(p, true).size(), 101);
+}
+
+TEST(convexHullTest, integerTest) {
+    using PointI = BasicPoint<long long>;
+    vector<PointI> p = {PointI(0, 0),
+                        PointI(1000000000, 1),
+                        PointI(2000000000, 2),
+                        PointI(1000000000, 1000000000)};
+    EXPECT_EQ(convex_hull_points(p).size(), 3);
+    EXPECT_EQ(convex_hull_points(p, true).size(), 4);
+}
@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <config.hpp>
+#include <convex_hull.hpp>
+#include <convex_polygon_locator.hpp>
+#include <point_buffer.hpp>
+#include <polygon.hpp>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+TEST(convexPolygonLocatorTest, squareTest) {
+    // 辺の途中の頂点 (1, 0) は取り除かれる
+    Polygon pl = {Point(0.0, 0.0),
+                  Point(1.0, 0.0),
+                  Point(2.0, 0.0),
+                  Point(2.0, 2.0),
+                  Point(0.0, 2.0)};
+    ConvexPolygonLocator loc(pl);
+    EXPECT_EQ(loc.size(), 4);
+    EXPECT_EQ(loc.locate(Point(1.0, 1.0)), PointLocation::INSIDE);
+    EXPECT_EQ(loc.locate(Point(0.1, 1.9)), PointLocation::INSIDE);
+    EXPECT_EQ(loc.locate(Point(1.0, 0.0)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(0.0, 0.0)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(0.0, 1.0)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(2.0, 1.5)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(1.0, 2.0)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(3.0, 0.0)), PointLocation::OUTSIDE);
+    EXPECT_EQ(loc.locate(Point(0.0, -1.0)), PointLocation::OUTSIDE);
+    EXPECT_EQ(loc.locate(Point(3.0, 3.0)), PointLocation::OUTSIDE);
+    EXPECT_EQ(loc.locate(Point(2.1, 1.0)), PointLocation::OUTSIDE);
+    EXPECT_EQ(loc.locate(Point(-0.1, 1.0)), PointLocation::OUTSIDE);
+    EXPECT_TRUE(loc.inside(Point(1.5, 0.5)));
+    EXPECT_TRUE(loc.on_object(Point(2.0, 2.0)));
+    EXPECT_TRUE(loc.outside(Point(-1.0, -1.0)));
+}
+
+TEST(convexPolygonLocatorTest, randomTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-1.0, 1.0);
+    vector<Point>               p(1000), q(10000);
+    for (Point &r : p) r = Point(unit(rng), unit(rng));
+    for (Point &r : q) r = Point(1.2 * unit(rng), 1.2 * unit(rng));
+    Polygon               pl = convex_hull(p);
+    ConvexPolygonLocator  loc(pl);
+    PointBuffer           buf(q);
+    vector<PointLocation> v1 = loc.locate(q), v2 = loc.locate(buf);
+    EXPECT_EQ(v1, v2);
+    for (size_t i = 0; i < q.size(); i++) {
+        PointLocation expected =
+            pl.on_object(q[i])
+                ? PointLocation::ON_BOUNDARY
+                : (pl.inside(q[i]) ? PointLocation::INSIDE
+                                   : PointLocation::OUTSIDE);
+        EXPECT_EQ(v1[i], expected);
+    }
+    // 頂点と辺の中点は境界上
+    for (size_t i = 0; i < pl.size(); i++) {
+        Point a = pl[i], b = pl[(i + 1) % pl.size()];
+        EXPECT_EQ(loc.locate(a), PointLocation::ON_BOUNDARY);
+        EXPECT_EQ(loc.locate(mid_point(a, b)), PointLocation::ON_BOUNDARY);
+    }
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <config.hpp>
+#include <convex_hull.hpp>
+#include <delaunay.hpp>
+#include <random>
+#include <robust_predicate.hpp>
+#include <set>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+using PointI = BasicPoint<int>;
+
+// 向きと隣接関係が正しく，どの辺も局所的に Delaunay であるか調べる
+// delaunay が false なら最後の条件は調べない
+template <class Predicate, class T>
+void check_triangulation(const vector<BasicPoint<T>>          &p,
+                         const BasicDelaunay<T, Predicate> &d,
+                         bool                               delaunay = true) {
+    using D                     = BasicDelaunay<T, Predicate>;
+    const vector<size_t> &tri   = d.triangles();
+    const vector<size_t> &half  = d.halfedges();
+    size_t                 hull = 0;
+    ASSERT_EQ(tri.size(), half.size());
+    for (size_t t = 0; t < d.size(); t++) {
+        auto v = d.triangle(t);
+        EXPECT_EQ(ccw<ExactPredicate>(p[v[0]], p[v[1]], p[v[2]]),
+                  COUNTER_CLOCKWISE);
+    }
+    for (size_t e = 0; e < tri.size(); e++) {
+        size_t f = half[e];
+        if (f == D::NONE) {
+            hull++;
+            continue;
+        }
+        ASSERT_EQ(half[f], e);
+        EXPECT_EQ(tri[e], tri[D::next(f)]);
+        EXPECT_EQ(tri[f], tri[D::next(e)]);
+        if (!delaunay) continue;
+        // 向かいの頂点は外接円の内部にない
+        EXPECT_FALSE(in_circle<ExactPredicate>(Point(p[tri[e]]),
+                                               Point(p[tri[D::next(e)]]),
+                                               Point(p[tri[D::prev(e)]]),
+                                               Point(p[tri[D::prev(f)]])));
+    }
+    // 使われた頂点の数を n とすると三角形は 2n - 2 - (凸包の辺の数) 個
+    set<size_t> used(begin(tri), end(tri));
+    EXPECT_EQ(d.size(), 2 * used.size() - 2 - hull);
+    // 使われなかった点は skipped() に並び，使われた点のどれかと等しい
+    EXPECT_EQ(used.size() + d.skipped().size(), p.size());
+    if (d.empty()) return;
+    for (size_t i : d.skipped()) {
+        EXPECT_EQ(used.count(i), 0u);
+        EXPECT_TRUE(any_of(begin(used), end(used), [&](size_t v) {
+            return Predicate::equal(p[v], p[i]);
+        }));
+    }
+    // 厳密な判定では使われた点の数は異なる座標の数に等しい
+    if constexpr (is_same_v<Predicate, ExactPredicate>) {
+        set<pair<T, T>> distinct;
+        for (const auto &q : p) distinct.emplace(q.x(), q.y());
+        EXPECT_EQ(used.size(), distinct.size());
+    }
+}
+
+vector<Point> random_points(size_t n, unsigned seed) {
+    mt19937                     rng(seed);
+    uniform_real_distribution<> unit(-100.0, 100.0);
+    vector<Point>               ret(n);
+    for (Point &p : ret) p = Point(unit(rng), unit(rng));
+    return ret;
+}
+
+}  // namespace
+
+TEST(delaunayTest, degenerateTest) {
+    EXPECT_TRUE(Delaunay(vector<Point>()).empty());
+    EXPECT_TRUE(Delaunay({Point(1.0, 2.0), Point(1.0, 2.0)}).empty());
+    EXPECT_TRUE(
+        Delaunay({Point(0.0, 0.0), Point(2.0, 2.0), Point(1.0, 1.0)}).empty());
+    Delaunay d({Point(0.0, 0.0), Point(2.0, 0.0), Point(0.0, 2.0)});
+    ASSERT_EQ(d.size(), 1u);
+    auto v = d.triangle(0);
+    EXPECT_EQ(set<size_t>(begin(v), end(v)), set<size_t>({0, 1, 2}));
+    for (size_t e = 0; e < 3; e++) EXPECT_EQ(d.halfedges()[e], Delaunay::NONE);
+}
+
+TEST(delaunayTest, squareTest) {
+    // 4点が同一円周上にあるときはどちらの対角線でもよい
+    vector<Point> p = {Point(0.0, 0.0),
+                       Point(1.0, 0.0),
+                       Point(1.0, 1.0),
+                       Point(0.0, 1.0),
+                       Point(0.5, 0.5),
+                       Point(1.0, 1.0)};
+    BasicDelaunay<Real, ExactPredicate> d(p);
+    EXPECT_EQ(d.size(), 4u);
+    check_triangulation(p, d);
+    for (size_t v : d.triangles()) EXPECT_NE(v, 5u);
+}
+
+TEST(delaunayTest, randomTest) {
+    for (unsigned seed = 0; seed < 5; seed++) {
+        vector<Point> p = random_points(500, seed);
+        Delaunay      d(p, seed);
+        check_triangulation(p, d);
+        EXPECT_EQ(set<size_t>(begin(d.triangles()), end(d.triangles())).size(),
+                  p.size());
+        Real area = 0;
+        for (size_t t = 0; t < d.size(); t++) {
+            auto v = d.triangle(t);
+            area += cross(p[v[1]] - p[v[0]], p[v[2]] - p[v[0]]) / 2;
+        }
+        EXPECT_NEAR(area, convex_hull(p).area(), 1e-6);
+        // 空円性を全ての点について確かめる
+        for (size_t t = 0; t < d.size(); t++) {
+            auto v = d.triangle(t);
+            for (size_t i = 0; i < p.size(); i++) {
+                EXPECT_FALSE(
+                    in_circle<ExactPredicate>(p[v[0]], p[v[1]], p[v[2]], p[i]));
+            }
+        }
+    }
+}
+
+TEST(delaunayTest, latticeTest) {
+    // 同一円周上の点や一直線上の点，重複する点が多い入力
+    mt19937                    rng(1);
+    uniform_int_distribution<> coord(0, 15);
+    vector<Point>              p;
+    vector<PointI>             q;
+    vector<BasicPoint<float>>  r;
+    for (int i = 0; i < 400; i++) {
+        int x = coord(rng), y = coord(rng);
+        p.emplace_back(x, y);
+        q.emplace_back(x, y);
+        r.emplace_back(x, y);
+    }
+    BasicDelaunay<Real, ExactPredicate> d(p);
+    check_triangulation(p, d);
+    BasicDelaunay<int> e(q);
+    check_triangulation(q, e);
+    EXPECT_EQ(d.size(), e.size());
+    // ExactPredicate は double 以外の座標にも使える
+    BasicDelaunay<int, ExactPredicate> f(q);
+    check_triangulation(q, f);
+    EXPECT_EQ(d.size(), f.size());
+    BasicDelaunay<float, ExactPredicate> g(r);
+    check_triangulation(r, g);
+    EXPECT_EQ(d.size(), g.size());
+}
+
+TEST(delaunayTest, exactEqualTest) {
+    // EPS の範囲で全て等しい点も ExactPredicate では別の点として扱う
+    mt19937                     rng(2);
+    uniform_real_distribution<> unit(1e7, 1e7 + 1e-3);
+    vector<Point>               p(2000);
+    for (Point &q : p) q = Point(unit(rng), unit(rng));
+    EXPECT_TRUE(Delaunay(p).empty());
+    BasicDelaunay<Real, ExactPredicate> d(p);
+    check_triangulation(p, d);
+    EXPECT_EQ(set<size_t>(begin(d.triangles()), end(d.triangles())).size(),
+              p.size());
+}
+
+TEST(delaunayTest, jitterTest) {
+    // 格子点を少しずらすと EPS の判定では空洞が星形にならないことがある
+    for (Real jitter : {1e-12, 1e-11, 1e-10, 1e-9}) {
+        mt19937                     rng(3);
+        uniform_real_distribution<> unit(-jitter, jitter);
+        vector<Point>               p;
+        for (int i = 0; i < 100; i++) {
+            for (int j = 0; j < 100; j++) {
+                p.emplace_back(i + unit(rng), j + unit(rng));
+            }
+        }
+        shuffle(begin(p), end(p), rng);
+        // EPS の判定ではほぼ一直線上の点の外接円が定まらないので，
+        // 空円性は調べない
+        Delaunay d(p);
+        check_triangulation(p, d, false);
+        EXPECT_TRUE(d.skipped().empty());
+    }
+}
+
+TEST(delaunayTest, largeTest) {
+    vector<Point> p = random_points(100000, 7);
+    Delaunay      d(p);
+    check_triangulation(p, d);
+}
+
+TEST(delaunayTest, brioOrderTest) {
+    vector<Point>  p     = random_points(1000, 3);
+    vector<size_t> order = internal::brio_order(p, 0);
+    sort(begin(order), end(order));
+    for (size_t i = 0; i < p.size(); i++) EXPECT_EQ(order[i], i);
+}
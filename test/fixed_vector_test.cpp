@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <config.hpp>
+#include <cross_point.hpp>
+#include <fixed_vector.hpp>
+#include <point.hpp>
+#include <tangent.hpp>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+TEST(fixedVectorTest, constructorTest) {
+    FixedVector<Point, 2> v0, v1 = {Point(1.0, 2.0)},
+                              v2 = {Point(1.0, 2.0), Point(3.0, 4.0)};
+    EXPECT_TRUE(v0.empty());
+    EXPECT_EQ(v1.size(), 1);
+    EXPECT_EQ(v2.size(), 2);
+    EXPECT_EQ(v2.capacity(), 2);
+    EXPECT_EQ(v2[1], Point(3.0, 4.0));
+    EXPECT_EQ(v2.front(), Point(1.0, 2.0));
+    EXPECT_EQ(v2.back(), Point(3.0, 4.0));
+}
+
+TEST(fixedVectorTest, modifierTest) {
+    FixedVector<int, 3> v;
+    v.push_back(1);
+    v.push_back(2);
+    v.push_back(3);
+    EXPECT_EQ(v.size(), 3);
+    v.pop_back();
+    EXPECT_EQ(v.size(), 2);
+    EXPECT_EQ(v.back(), 2);
+    v[0] = 5;
+    int sum = 0;
+    for (int x : v) sum += x;
+    EXPECT_EQ(sum, 7);
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST(fixedVectorTest, vectorCompatibilityTest) {
+    FixedVector<int, 2> v = {1, 2}, w = {1};
+    vector<int>         u = v;
+    EXPECT_EQ(u, vector<int>({1, 2}));
+    EXPECT_TRUE(v == u);
+    EXPECT_TRUE(u == v);
+    EXPECT_TRUE(w != u);
+    EXPECT_TRUE(v != w);
+    u = w;
+    EXPECT_EQ(u.size(), 1);
+}
+
+TEST(fixedVectorTest, crossPointTest) {
+    Circle c(Point(0.0, 0.0), 1.0);
+    Line   l(Point(-2.0, 0.0), Point(2.0, 0.0));
+    auto   v = cross_point(c, l);
+    static_assert(is_same<decltype(v), FixedVector<Point, 2>>::value,
+                  "cross_point must not allocate");
+    vector<Point> expected = {Point(1.0, 0.0), Point(-1.0, 0.0)};
+    EXPECT_TRUE(v == expected);
+    auto t = tangent(c, Point(1.0, 0.0));
+    EXPECT_TRUE(t == vector<Point>({Point(1.0, 0.0)}));
+}
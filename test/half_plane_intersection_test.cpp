@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <config.hpp>
+#include <convex_cut.hpp>
+#include <half_plane_intersection.hpp>
+#include <line.hpp>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 大きな正方形を順に切って求めた共通部分の面積
+Real cut_area(const vector<Line> &lines) {
+    vector<Point> region = {Point(-1e4, -1e4),
+                            Point(1e4, -1e4),
+                            Point(1e4, 1e4),
+                            Point(-1e4, 1e4)},
+                  buf;
+    for (const Line &l : lines) {
+        convex_cut(region, l, buf);
+        swap(region, buf);
+    }
+    return region.size() < 3 ? 0.0 : Polygon(region).area();
+}
+
+}  // namespace
+
+TEST(halfPlaneIntersectionTest, basicTest) {
+    // 三角形と，それを含む余分な半平面
+    vector<Line> lines = {Line(Point(0.0, 0.0), Point(1.0, 0.0)),
+                          Line(Point(2.0, 0.0), Point(0.0, 2.0)),
+                          Line(Point(0.0, 1.0), Point(0.0, 0.0)),
+                          Line(Point(0.0, -1.0), Point(1.0, -1.0)),
+                          Line(Point(3.0, 0.0), Point(0.0, 3.0))};
+    vector<Point> out;
+    EXPECT_EQ(half_plane_intersection(lines, out), HalfPlaneStatus::BOUNDED);
+    EXPECT_EQ(out.size(), 3u);
+    auto pl = half_plane_intersection(lines);
+    ASSERT_TRUE(pl);
+    EXPECT_DOUBLE_EQ(pl->area(), 2.0);
+    // 線分に潰れる場合と空の場合
+    vector<Line> segment = lines;
+    segment.push_back(Line(Point(0.0, 0.0), Point(1.0, 1.0)));
+    segment.push_back(Line(Point(1.0, 1.0), Point(0.0, 0.0)));
+    EXPECT_EQ(half_plane_intersection(segment, out), HalfPlaneStatus::EMPTY);
+    EXPECT_TRUE(out.empty());
+    EXPECT_FALSE(half_plane_intersection(segment));
+    lines.push_back(Line(Point(5.0, 1.0), Point(5.0, 0.0)));
+    EXPECT_EQ(half_plane_intersection(lines, out), HalfPlaneStatus::EMPTY);
+}
+
+TEST(halfPlaneIntersectionTest, unboundedTest) {
+    vector<Point> out;
+    // 帯と，3方向しかない領域
+    vector<Line> strip = {Line(Point(0.0, 0.0), Point(1.0, 0.0)),
+                          Line(Point(0.0, 1.0), Point(-1.0, 1.0))};
+    EXPECT_EQ(half_plane_intersection(strip, out), HalfPlaneStatus::UNBOUNDED);
+    strip.push_back(Line(Point(0.0, 1.0), Point(0.0, 0.0)));
+    EXPECT_EQ(half_plane_intersection(strip, out), HalfPlaneStatus::UNBOUNDED);
+    strip.push_back(Line(Point(5.0, 0.0), Point(5.0, 1.0)));
+    EXPECT_EQ(half_plane_intersection(strip, out), HalfPlaneStatus::BOUNDED);
+    EXPECT_DOUBLE_EQ(Polygon(out).area(), 5.0);
+    EXPECT_EQ(half_plane_intersection(vector<Line>(), out),
+              HalfPlaneStatus::UNBOUNDED);
+}
+
+TEST(halfPlaneIntersectionTest, integerTest) {
+    using PointI = BasicPoint<int>;
+    using LineI  = BasicLine<int>;
+    vector<LineI> lines = {LineI(PointI(0, 0), PointI(4, 0)),
+                           LineI(PointI(4, 0), PointI(4, 4)),
+                           LineI(PointI(4, 4), PointI(0, 4)),
+                           LineI(PointI(0, 4), PointI(0, 0)),
+                           LineI(PointI(8, 0), PointI(0, 8))};
+    auto pl = half_plane_intersection(lines);
+    ASSERT_TRUE(pl);
+    EXPECT_EQ(pl->area2(), 32);
+    // 頂点は最も近い整数に丸める
+    vector<LineI> cut = {LineI(PointI(0, 0), PointI(1, 0)),
+                         LineI(PointI(10, 0), PointI(10, 10)),
+                         LineI(PointI(1, 10), PointI(0, 10)),
+                         LineI(PointI(3, 5), PointI(0, -2))};
+    vector<PointI> out;
+    ASSERT_EQ(half_plane_intersection(cut, out), HalfPlaneStatus::BOUNDED);
+    ASSERT_EQ(out.size(), 4u);
+    vector<PointI> expected = {
+        PointI(1, 0), PointI(10, 0), PointI(10, 10), PointI(5, 10)};
+    for (const PointI &p : expected) {
+        EXPECT_NE(find(begin(out), end(out), p), end(out));
+    }
+}
+
+TEST(halfPlaneIntersectionTest, parallelTest) {
+    vector<Point> out;
+    // 向きが同じで長さの違う直線は最も狭いものだけが効く
+    vector<Line> lines = {Line(Point(0.0, 0.0), Point(4.0, 4.0)),
+                          Line(Point(0.0, -1.0), Point(1.0, 0.0)),
+                          Line(Point(4.0, 0.0), Point(0.0, 4.0)),
+                          Line(Point(0.0, 8.0), Point(-3.0, 5.0)),
+                          Line(Point(0.0, 0.0), Point(1.0, -1.0))};
+    ASSERT_EQ(half_plane_intersection(lines, out), HalfPlaneStatus::BOUNDED);
+    EXPECT_DOUBLE_EQ(Polygon(out).area(), 16.0);
+    // 1 ulp だけ傾いた直線は平行でないものとして扱う
+    Real         y = nextafter(1.0, 2.0);
+    vector<Line> tilt = {Line(Point(0.0, 0.0), Point(4.0, 0.0)),
+                         Line(Point(4.0, 0.0), Point(4.0, 4.0)),
+                         Line(Point(4.0, 4.0), Point(0.0, 4.0)),
+                         Line(Point(0.0, 4.0), Point(0.0, 0.0)),
+                         Line(Point(0.0, 1.0), Point(4.0, y)),
+                         Line(Point(4.0, 1.0), Point(0.0, 1.0))};
+    HalfPlaneStatus s = half_plane_intersection(tilt, out);
+    EXPECT_NE(s, HalfPlaneStatus::UNBOUNDED);
+    if (s == HalfPlaneStatus::BOUNDED) {
+        EXPECT_NEAR(Polygon(out).area(), cut_area(tilt), 1e-9);
+    }
+}
+
+TEST(halfPlaneIntersectionTest, randomTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-10.0, 10.0), angle(0.0, 2 * PI);
+    for (int t = 0; t < 300; t++) {
+        // 点 c の近くを通る直線を向きをばらばらにして並べる
+        Point        c(unit(rng), unit(rng));
+        vector<Line> lines;
+        int          n = 3 + t % 20;
+        for (int i = 0; i < n; i++) {
+            Point p = c + Point(unit(rng), unit(rng)) / 4,
+                  d = Point::polar(angle(rng));
+            // 半分の場合は全ての半平面が c を含むようにする
+            if (t % 2 == 0 && ccw(p, p + d, c) == CLOCKWISE) d = -d;
+            lines.emplace_back(p, p + d);
+        }
+        vector<Point>   out;
+        HalfPlaneStatus s = half_plane_intersection(lines, out);
+        if (s == HalfPlaneStatus::UNBOUNDED) continue;
+        Real expected = cut_area(lines);
+        if (s == HalfPlaneStatus::EMPTY) {
+            EXPECT_NEAR(expected, 0.0, 1e-6);
+            continue;
+        }
+        Polygon pl(out);
+        EXPECT_NEAR(pl.area(), expected, 1e-6);
+        EXPECT_TRUE(pl.is_convex());
+    }
+}
+
+TEST(halfPlaneIntersectionTest, largeTest) {
+    // 単位円に接する多数の半平面の共通部分は円にほぼ等しい
+    mt19937                     rng(1);
+    uniform_real_distribution<> angle(0.0, 2 * PI);
+    vector<Line>                lines;
+    for (int i = 0; i < 100000; i++) {
+        Point n = Point::polar(angle(rng));
+        lines.emplace_back(n, n + rotate(n, PI / 2));
+    }
+    auto pl = half_plane_intersection(lines);
+    ASSERT_TRUE(pl);
+    EXPECT_NEAR(pl->area(), PI, 1e-6);
+    EXPECT_TRUE(pl->is_convex());
+}
@@ -58,13 +58,32 @@ TEST(intersectionTest, SegmentAndSegmentSameLine) {
     Segment sg1(Point(0.0, 2.0), Point(-2.0, 0.0)),
         sg2(Point(-2.0, 0.0), Point(-10.0, -8.0)),
         sg3(Point(10.0, 8.0), Point(0.0, 2.0)),
-        sg4(Point(4.0, 6.0), Point(-6.0, -4.0));
+        sg4(Point(4.0, 6.0), Point(-6.0, -4.0)),
+        sg5(Point(-3.0, -1.0), Point(-5.0, -3.0));
     EXPECT_TRUE(intersection(sg1, sg2));
     EXPECT_TRUE(intersection(sg1, sg3));
     EXPECT_TRUE(intersection(sg1, sg4));
     EXPECT_TRUE(intersection(sg2, sg4));
     EXPECT_TRUE(intersection(sg3, sg4));
     EXPECT_FALSE(intersection(sg3, sg2));
+    EXPECT_FALSE(intersection(sg1, sg5));
+    EXPECT_FALSE(intersection(sg5, sg1));
+}
+
+TEST(intersectionTest, SegmentAndSegmentInteger) {
+    using SegmentI = BasicSegment<int>;
+    using PointI   = BasicPoint<int>;
+    const int big  = 1 << 29;
+    SegmentI  sg1(PointI(-big, -big), PointI(big, big)),
+        sg2(PointI(-big, big), PointI(big, -big)),
+        sg3(PointI(big, big), PointI(big + 1, big + 1)),
+        sg4(PointI(big, big - 1), PointI(big - 1, -big)),
+        sg5(PointI(1 - big, -big), PointI(big, big - 1));
+    EXPECT_TRUE(intersection(sg1, sg2));
+    EXPECT_TRUE(intersection(sg1, sg3));
+    EXPECT_FALSE(intersection(sg1, sg4));
+    EXPECT_FALSE(intersection(sg1, sg5));
+    EXPECT_TRUE(intersection(sg2, sg5));
 }
 
 TEST(intersectionTest, CircleAndCircle) {
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <config.hpp>
+#include <kd_tree.hpp>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 全ての点との距離の2乗を昇順に並べたもの
+vector<pair<Real, size_t>> sorted_dist(const vector<Point> &p,
+                                       const Point         &q) {
+    vector<pair<Real, size_t>> ret;
+    for (size_t i = 0; i < p.size(); i++) ret.emplace_back(norm(p[i] - q), i);
+    sort(begin(ret), end(ret));
+    return ret;
+}
+
+vector<Point> random_points(size_t n, unsigned seed) {
+    mt19937                     rng(seed);
+    uniform_real_distribution<> unit(-100.0, 100.0);
+    vector<Point>               ret(n);
+    for (Point &p : ret) p = Point(unit(rng), unit(rng));
+    return ret;
+}
+
+}  // namespace
+
+TEST(kdTreeTest, smallTest) {
+    vector<Point> p = {Point(0.0, 0.0),
+                       Point(2.0, 0.0),
+                       Point(0.0, 3.0),
+                       Point(5.0, 5.0),
+                       Point(-1.0, 1.0)};
+    KdTree        tree(p);
+    EXPECT_EQ(tree.size(), 5u);
+    EXPECT_EQ(tree.nearest(Point(4.0, 4.0)).first, 3u);
+    EXPECT_DOUBLE_EQ(tree.nearest(Point(4.0, 4.0)).second, 2.0);
+    EXPECT_EQ(tree.nearest(Point(-1.0, 1.0)).first, 4u);
+    auto knn = tree.k_nearest(Point(0.0, 0.0), 3);
+    ASSERT_EQ(knn.size(), 3u);
+    EXPECT_EQ(knn[0].first, 0u);
+    EXPECT_EQ(knn[1].first, 4u);
+    EXPECT_EQ(knn[2].first, 1u);
+    EXPECT_EQ(tree.k_nearest(Point(0.0, 0.0), 10).size(), 5u);
+    EXPECT_TRUE(tree.k_nearest(Point(0.0, 0.0), 0).empty());
+    auto in = tree.within_radius(Point(0.0, 0.0), 2.0);
+    sort(begin(in), end(in));
+    EXPECT_EQ(in, vector<size_t>({0, 1, 4}));
+}
+
+TEST(kdTreeTest, randomTest) {
+    for (size_t n : {1, 2, 3, 7, 100, 1000}) {
+        vector<Point> p = random_points(n, n), q = random_points(100, 0);
+        KdTree        tree(p);
+        for (const Point &r : q) {
+            auto dist = sorted_dist(p, r);
+            auto near = tree.nearest(r);
+            EXPECT_DOUBLE_EQ(near.second, dist[0].first);
+            auto knn = tree.k_nearest(r, 5);
+            ASSERT_EQ(knn.size(), min<size_t>(5, n));
+            for (size_t i = 0; i < knn.size(); i++) {
+                EXPECT_DOUBLE_EQ(knn[i].second, dist[i].first);
+                EXPECT_DOUBLE_EQ(knn[i].second, norm(p[knn[i].first] - r));
+            }
+            auto in = tree.within_radius(r, 30.0);
+            sort(begin(in), end(in));
+            vector<size_t> expected;
+            for (const auto &d : dist) {
+                if (d.first <= 900.0) expected.push_back(d.second);
+            }
+            sort(begin(expected), end(expected));
+            EXPECT_EQ(in, expected);
+        }
+    }
+}
+
+TEST(kdTreeTest, integerTest) {
+    // 重複する点を多く含む整数座標
+    using PointI = BasicPoint<int>;
+    mt19937                    rng(3);
+    uniform_int_distribution<> coord(0, 20);
+    vector<PointI>             p(500);
+    for (PointI &r : p) r = PointI(coord(rng), coord(rng));
+    BasicKdTree<int> tree(p);
+    for (int t = 0; t < 100; t++) {
+        PointI    r(coord(rng), coord(rng));
+        long long best = norm(p[0] - r);
+        for (const PointI &s : p) best = min<long long>(best, norm(s - r));
+        EXPECT_EQ(tree.nearest(r).second, best);
+    }
+}
+
+TEST(kdTreeTest, parallelTest) {
+    vector<Point> p = random_points(100000, 1), q = random_points(1000, 2);
+    KdTree        seq(p), par(p, 4);
+    auto          a = seq.nearest(q), b = par.nearest(q, 4);
+    auto          c = par.k_nearest(q, 3, 4);
+    ASSERT_EQ(a.size(), q.size());
+    for (size_t i = 0; i < q.size(); i++) {
+        EXPECT_DOUBLE_EQ(a[i].second, b[i].second);
+        EXPECT_EQ(a[i].first, b[i].first);
+        ASSERT_EQ(c[i].size(), 3u);
+        EXPECT_DOUBLE_EQ(c[i][0].second, a[i].second);
+    }
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <config.hpp>
+#include <intersection.hpp>
+#include <manhattan_intersection.hpp>
+#include <random>
+#include <segment.hpp>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+using PointI   = BasicPoint<int>;
+using SegmentI = BasicSegment<int>;
+
+TEST(manhattanIntersectionTest, sampleTest) {
+    // CGL_6_A の入力例
+    vector<SegmentI> s = {SegmentI(PointI(2, 2), PointI(2, 5)),
+                          SegmentI(PointI(1, 3), PointI(5, 3)),
+                          SegmentI(PointI(4, 1), PointI(4, 4)),
+                          SegmentI(PointI(5, 2), PointI(7, 2)),
+                          SegmentI(PointI(6, 1), PointI(6, 3)),
+                          SegmentI(PointI(6, 5), PointI(6, 7))};
+    EXPECT_EQ(count_manhattan_intersections(s), 3);
+    vector<pair<size_t, size_t>> res;
+    manhattan_intersections(s, [&](size_t i, size_t j, const PointI &p) {
+        EXPECT_TRUE(s[i].on_object(p));
+        EXPECT_TRUE(s[j].on_object(p));
+        res.emplace_back(i, j);
+    });
+    sort(begin(res), end(res));
+    vector<pair<size_t, size_t>> expected = {{0, 1}, {1, 2}, {3, 4}};
+    EXPECT_EQ(res, expected);
+}
+
+TEST(manhattanIntersectionTest, touchTest) {
+    // 端点で接する場合も数える
+    vector<Segment> s = {Segment(Point(0.0, 0.0), Point(4.0, 0.0)),
+                         Segment(Point(0.0, 0.0), Point(0.0, 3.0)),
+                         Segment(Point(4.0, -2.0), Point(4.0, 0.0)),
+                         Segment(Point(2.0, 1.0), Point(2.0, 3.0)),
+                         Segment(Point(-1.0, 3.0), Point(2.0, 3.0))};
+    EXPECT_EQ(count_manhattan_intersections(s), 4);
+}
+
+TEST(manhattanIntersectionTest, randomTest) {
+    mt19937                    rng(0);
+    uniform_int_distribution<> coord(-30, 30);
+    for (int t = 0; t < 10; t++) {
+        // 平行な線分どうしは重ならないように，水平な線分の y 座標は偶数，
+        // 垂直な線分の x 座標は奇数で，それぞれ相異なるものにする
+        vector<SegmentI> s;
+        vector<int>      used(2 * 61 + 1, 0);
+        for (int i = 0; i < 60; i++) {
+            int a = coord(rng), b = coord(rng), c = 2 * coord(rng);
+            if (a == b || used[c + 61 + (i % 2)]++) continue;
+            if (i % 2 == 0)
+                s.emplace_back(PointI(a, c), PointI(b, c));
+            else
+                s.emplace_back(PointI(c + 1, a), PointI(c + 1, b));
+        }
+        long long brute = 0;
+        for (size_t i = 0; i < s.size(); i++) {
+            for (size_t j = i + 1; j < s.size(); j++) {
+                brute += intersection(s[i], s[j]);
+            }
+        }
+        long long enumerated = 0;
+        manhattan_intersections(s, [&](size_t i, size_t j, const PointI &p) {
+            EXPECT_LT(i, j);
+            EXPECT_TRUE(intersection(s[i], s[j]));
+            EXPECT_TRUE(s[i].on_object(p));
+            enumerated++;
+        });
+        EXPECT_EQ(count_manhattan_intersections(s), brute);
+        EXPECT_EQ(enumerated, brute);
+    }
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <point.hpp>
+#include <point_buffer.hpp>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 誤差が出やすい値を含む点の列
+vector<Point> sample_points() {
+    return {Point(3.0, 2.0),
+            Point(0.1, -0.7),
+            Point(-PI, 1e-9),
+            Point(123456.789, -0.333333333333),
+            Point(1e15, 1e-15),
+            Point(0.0, 0.0),
+            Point(-2.5, -4.0)};
+}
+
+}  // namespace
+
+TEST(pointBufferTest, constructorTest) {
+    PointBuffer buf1, buf2(3), buf3 = {Point(1.0, 2.0), Point(-3.0, 4.5)};
+    EXPECT_TRUE(buf1.empty());
+    EXPECT_EQ(buf2.size(), 3);
+    EXPECT_TRUE(buf2[2] == Point(0.0, 0.0));
+    EXPECT_EQ(buf3.size(), 2);
+    EXPECT_EQ(buf3.x_data()[1], -3.0);
+    EXPECT_EQ(buf3.y_data()[1], 4.5);
+    PointBuffer buf4(sample_points());
+    EXPECT_EQ(buf4.size(), sample_points().size());
+}
+
+TEST(pointBufferTest, accessTest) {
+    PointBuffer buf;
+    buf.push_back(Point(1.0, 2.0));
+    buf.push_back(Point(-1.0, 0.5));
+    EXPECT_TRUE(buf[0] == Point(1.0, 2.0));
+    EXPECT_TRUE(buf[1] == Point(-1.0, 0.5));
+    buf.set(0, Point(7.0, -7.0));
+    EXPECT_TRUE(buf[0] == Point(7.0, -7.0));
+    vector<Point> pts = buf.to_points();
+    EXPECT_EQ(pts.size(), 2);
+    EXPECT_TRUE(pts[1] == Point(-1.0, 0.5));
+    buf.clear();
+    EXPECT_TRUE(buf.empty());
+}
+
+TEST(pointBufferTest, dotTest) {
+    vector<Point> ps = sample_points(), qs = ps;
+    std::reverse(qs.begin(), qs.end());
+    PointBuffer  p(ps), q(qs);
+    vector<Real> r1 = dot(p, q), r2 = dot(p, Point(-0.3, 7.1));
+    for (size_t i = 0; i < ps.size(); i++) {
+        EXPECT_EQ(r1[i], dot(ps[i], qs[i]));
+        EXPECT_EQ(r2[i], dot(ps[i], Point(-0.3, 7.1)));
+    }
+}
+
+TEST(pointBufferTest, crossTest) {
+    vector<Point> ps = sample_points(), qs = ps;
+    std::reverse(qs.begin(), qs.end());
+    PointBuffer  p(ps), q(qs);
+    vector<Real> r1 = cross(p, q), r2 = cross(p, Point(-0.3, 7.1));
+    for (size_t i = 0; i < ps.size(); i++) {
+        EXPECT_EQ(r1[i], cross(ps[i], qs[i]));
+        EXPECT_EQ(r2[i], cross(ps[i], Point(-0.3, 7.1)));
+    }
+}
+
+TEST(pointBufferTest, normTest) {
+    vector<Point> ps = sample_points();
+    vector<Real>  r  = norm(PointBuffer(ps));
+    for (size_t i = 0; i < ps.size(); i++) {
+        EXPECT_EQ(r[i], norm(ps[i]));
+    }
+}
+
+TEST(pointBufferTest, distanceTest) {
+    vector<Point> ps = sample_points(), qs = ps;
+    std::reverse(qs.begin(), qs.end());
+    PointBuffer  p(ps), q(qs);
+    vector<Real> r1 = distance(p, q), r2 = distance(p, Point(2.0, -1.0));
+    for (size_t i = 0; i < ps.size(); i++) {
+        EXPECT_EQ(r1[i], distance(ps[i], qs[i]));
+        EXPECT_EQ(r2[i], distance(ps[i], Point(2.0, -1.0)));
+    }
+}
+
+TEST(pointBufferTest, ccwTest) {
+    Point       a(0.0, 0.0), b(2.0, 2.0);
+    PointBuffer c = {Point(0.0, 2.0),
+                     Point(2.0, 0.0),
+                     Point(-1.0, -1.0),
+                     Point(1.0, 1.0),
+                     Point(3.0, 3.0)};
+    vector<ClockWise> r = ccw(a, b, c);
+    EXPECT_EQ(r[0], COUNTER_CLOCKWISE);
+    EXPECT_EQ(r[1], CLOCKWISE);
+    EXPECT_EQ(r[2], ONLINE_BACK);
+    EXPECT_EQ(r[3], ON_SEGMENT);
+    EXPECT_EQ(r[4], ONLINE_FRONT);
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <point.hpp>
+#include <random>
+#include <robust_predicate.hpp>
+#include <vector>
 
 using namespace sapphre15::geometry;
 
@@ -328,4 +332,116 @@ TEST(pointTest, colinearTest) {
     EXPECT_FALSE(colinear(p, q, s));
     EXPECT_FALSE(colinear(p, s, r));
     EXPECT_FALSE(colinear(s, q, r));
-}
\ No newline at end of file
+}
+
+TEST(pointTest, floatCoordinateTest) {
+    using PointF = BasicPoint<float>;
+    PointF p(3.0f, 4.0f), q(1.0f, 0.0f);
+    EXPECT_FLOAT_EQ(abs(p), 5.0f);
+    EXPECT_FLOAT_EQ(dot(p, q), 3.0f);
+    EXPECT_FLOAT_EQ(cross(p, q), -4.0f);
+    EXPECT_EQ(ccw(PointF(), q, p), COUNTER_CLOCKWISE);
+    EXPECT_EQ(Point(p), Point(3.0, 4.0));
+}
+
+TEST(pointTest, integerCoordinateTest) {
+    using PointI = BasicPoint<long long>;
+    const long long big = 1000000000LL;
+    PointI          a(0, 0), b(big, big), c(2 * big, 2 * big),
+        d(2 * big, 2 * big + 1);
+    EXPECT_EQ(cross(b, d), big);
+    EXPECT_EQ(norm(b), 2 * big * big);
+    EXPECT_DOUBLE_EQ(abs(PointI(3, 4)), 5.0);
+    EXPECT_EQ(ccw(a, b, c), ONLINE_FRONT);
+    EXPECT_EQ(ccw(a, c, b), ON_SEGMENT);
+    EXPECT_EQ(ccw(b, c, a), ONLINE_BACK);
+    EXPECT_EQ(ccw(a, b, d), COUNTER_CLOCKWISE);
+    EXPECT_EQ(ccw(a, d, b), CLOCKWISE);
+    EXPECT_TRUE(colinear(a, b, c));
+}
+
+TEST(pointTest, integerInCircleTest) {
+    // 4次の項が 64 bit に収まらない大きさの座標
+    using PointI = BasicPoint<int>;
+    PointI a(0, 0), b(60000, 0), c(0, 60000);
+    EXPECT_FALSE(in_circle(a, b, c, PointI(120000, 120000)));
+    EXPECT_TRUE(out_circle(a, b, c, PointI(120000, 120000)));
+    EXPECT_TRUE(in_circle(a, b, c, PointI(30000, 30000)));
+    EXPECT_TRUE(on_circle(a, b, c, PointI(60000, 60000)));
+    // 範囲の端に近い座標でも浮動小数点数での厳密な判定と一致する
+    std::mt19937                    rng(0);
+    const int                       big = (1 << 30) - 1;
+    std::uniform_int_distribution<> coord(-big, big);
+    for (int k = 0; k < 1000; k++) {
+        PointI p[4];
+        for (PointI &q : p) q = PointI(coord(rng), coord(rng));
+        EXPECT_EQ(in_circle(p[0], p[1], p[2], p[3]),
+                  in_circle<ExactPredicate>(
+                      Point(p[0]), Point(p[1]), Point(p[2]), Point(p[3])));
+        BasicPoint<long long> r[4];
+        for (int i = 0; i < 4; i++) r[i] = BasicPoint<long long>(p[i]);
+        EXPECT_EQ(in_circle(r[0], r[1], r[2], r[3]),
+                  in_circle(p[0], p[1], p[2], p[3]));
+    }
+}
+
+TEST(pointTest, angleLessTest) {
+    // 偏角 [0, 2pi) の順に並べたもの
+    std::vector<Point> p = {Point(0.0, 0.0),
+                            Point(1.0, 0.0),
+                            Point(2.0, 1.0),
+                            Point(0.0, 3.0),
+                            Point(-1.0, 1e-300),
+                            Point(-1.0, 0.0),
+                            Point(-1.0, -1.0),
+                            Point(0.0, -2.0),
+                            Point(1.0, -1e-300)};
+    for (size_t i = 0; i < p.size(); i++) {
+        for (size_t j = 0; j < p.size(); j++) {
+            EXPECT_EQ(angle_less(p[i], p[j]), i < j);
+        }
+    }
+    // 同じ偏角の点はどちらも小さくない
+    EXPECT_FALSE(angle_less(Point(1.0, 1.0), Point(3.0, 3.0)));
+    EXPECT_FALSE(angle_less(Point(3.0, 3.0), Point(1.0, 1.0)));
+    EXPECT_TRUE(angle_less(BasicPoint<int>(-5, -1), BasicPoint<int>(5, -1)));
+    // 丸めた外積の符号では a < b < c < a となってしまう3点
+    Point a(0.99948306033104684, 0.62598342727761724),
+        b(3.452570394273609, 2.1623696629823645),
+        c(3.2424354105575555, 2.0307606117454853);
+    EXPECT_FALSE(angle_less(a, b) && angle_less(b, c) && angle_less(c, a));
+    EXPECT_FALSE(angle_less(a, c) && angle_less(c, b) && angle_less(b, a));
+    // 同じ直線上の点は誤差なく同じ偏角になる
+    Point d(0.1, 0.3);
+    EXPECT_FALSE(angle_less(d, d * 4.0));
+    EXPECT_FALSE(angle_less(d * 4.0, d));
+    EXPECT_TRUE(angle_less(d, Point(0.1, std::nextafter(0.3, 1.0))));
+}
+
+TEST(pointTest, sortByAngleTest) {
+    std::mt19937                    rng(0);
+    std::uniform_int_distribution<> coord(-20, 20);
+    std::uniform_real_distribution<> unit(-1.0, 1.0);
+    // 同じ偏角の点が多い整数座標
+    std::vector<BasicPoint<int>> p(5000);
+    for (auto &q : p) q = BasicPoint<int>(coord(rng), coord(rng));
+    BasicPoint<int> o(3, -2);
+    auto less = [&o](const BasicPoint<int> &a, const BasicPoint<int> &b) {
+        return angle_less(a - o, b - o);
+    };
+    std::vector<BasicPoint<int>> expected = p;
+    std::sort(std::begin(expected), std::end(expected), less);
+    sort_by_angle(std::begin(p), std::end(p), o);
+    EXPECT_TRUE(std::is_sorted(std::begin(p), std::end(p), less));
+    for (size_t i = 0; i < p.size(); i++) {
+        EXPECT_FALSE(less(p[i], expected[i]) || less(expected[i], p[i]));
+    }
+    // arg による順序と一致する
+    std::vector<Point> r(5000);
+    for (auto &q : r) q = Point(unit(rng), unit(rng));
+    sort_by_angle(std::begin(r), std::end(r), Point(0.0, 0.0));
+    for (size_t i = 1; i < r.size(); i++) {
+        Real a = arg(r[i - 1]), b = arg(r[i]);
+        EXPECT_LE(a < 0 ? a + 2 * PI : a, b < 0 ? b + 2 * PI : b);
+    }
+}
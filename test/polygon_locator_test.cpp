@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <config.hpp>
+#include <point_buffer.hpp>
+#include <polygon.hpp>
+#include <polygon_locator.hpp>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// Polygon::inside, Polygon::on_object による判定
+PointLocation brute_force(Polygon &pl, const Point &p) {
+    if (pl.on_object(p)) return PointLocation::ON_BOUNDARY;
+    return pl.inside(p) ? PointLocation::INSIDE : PointLocation::OUTSIDE;
+}
+
+}  // namespace
+
+TEST(polygonLocatorTest, concaveTest) {
+    // 凹型の多角形
+    Polygon        pl = {Point(0.0, 0.0),
+                         Point(4.0, 0.0),
+                         Point(4.0, 4.0),
+                         Point(2.0, 1.0),
+                         Point(0.0, 4.0)};
+    PolygonLocator loc(pl);
+    EXPECT_EQ(loc.locate(Point(1.0, 1.0)), PointLocation::INSIDE);
+    EXPECT_EQ(loc.locate(Point(3.5, 3.0)), PointLocation::INSIDE);
+    EXPECT_EQ(loc.locate(Point(2.0, 3.0)), PointLocation::OUTSIDE);
+    EXPECT_EQ(loc.locate(Point(2.0, 1.0)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(3.0, 2.5)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(4.0, 2.0)), PointLocation::ON_BOUNDARY);
+    EXPECT_EQ(loc.locate(Point(5.0, 2.0)), PointLocation::OUTSIDE);
+    EXPECT_EQ(loc.locate(Point(-1e-3, 0.0)), PointLocation::OUTSIDE);
+    EXPECT_TRUE(loc.inside(Point(2.0, 0.5)));
+    EXPECT_TRUE(loc.on_object(Point(0.0, 4.0)));
+    EXPECT_TRUE(loc.outside(Point(2.0, 2.0)));
+}
+
+TEST(polygonLocatorTest, randomStarTest) {
+    // 頂点数の多い星形多角形
+    const size_t                n = 2000;
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(0.0, 1.0);
+    vector<Point>               v(n);
+    for (size_t i = 0; i < n; i++) {
+        v[i] = Point::polar(2 * PI * i / n, 50.0 + 50.0 * unit(rng));
+    }
+    Polygon        pl(v);
+    PolygonLocator loc(pl);
+    vector<Point>  q;
+    for (int i = 0; i < 5000; i++) {
+        q.emplace_back(240 * unit(rng) - 120, 240 * unit(rng) - 120);
+    }
+    // 格子点や頂点，辺の中点など退化しやすい点を加える
+    for (int x = -110; x <= 110; x += 5) {
+        for (int y = -110; y <= 110; y += 5) q.emplace_back(x, y);
+    }
+    for (size_t i = 0; i < n; i += 7) {
+        q.push_back(v[i]);
+        q.push_back(mid_point(v[i], v[(i + 1) % n]));
+    }
+    PointBuffer           buf(q);
+    vector<PointLocation> v1 = loc.locate(q), v2 = loc.locate(buf);
+    EXPECT_EQ(v1, v2);
+    for (size_t i = 0; i < q.size(); i++) {
+        EXPECT_EQ(v1[i], brute_force(pl, q[i])) << q[i].x() << ' ' << q[i].y();
+    }
+}
+
+TEST(polygonLocatorTest, latticeTest) {
+    // 頂点が格子点上にある櫛形の多角形と，格子点での問い合わせ
+    vector<Point> v = {Point(0.0, 0.0), Point(20.0, 0.0)};
+    for (int i = 10; i > 0; i--) {
+        v.emplace_back(2.0 * i, 10.0);
+        v.emplace_back(2.0 * i - 1, 10.0);
+        v.emplace_back(2.0 * i - 1, 1.0);
+        v.emplace_back(2.0 * i - 2, 1.0);
+    }
+    Polygon        pl(v);
+    PolygonLocator loc(pl);
+    for (int x = -1; x <= 21; x++) {
+        for (int y = -1; y <= 11; y++) {
+            Point p(x, y);
+            EXPECT_EQ(loc.locate(p), brute_force(pl, p)) << x << ' ' << y;
+            Point r(x + 0.5, y + 0.5);
+            EXPECT_EQ(loc.locate(r), brute_force(pl, r)) << x << ' ' << y;
+        }
+    }
+}
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <config.hpp>
 #include <polygon.hpp>
+#include <random>
+#include <segment.hpp>
 #include <vector>
 
 using namespace sapphre15::geometry;
@@ -42,6 +46,16 @@ TEST(polygonTest, areaTest) {
     EXPECT_DOUBLE_EQ(pl2.area(), 43.0);
 }
 
+TEST(polygonTest, integerAreaTest) {
+    using PointI         = BasicPoint<std::int64_t>;
+    const std::int64_t n = 1000000000000LL;
+    BasicPolygon<std::int64_t> pl = {
+        PointI(0, 0), PointI(0, n), PointI(n, n), PointI(n, 1)};
+    // 時計回りに与えても反時計回りに並べ替えられる
+    EXPECT_TRUE(pl.area2() == internal::int128_t(n) * (2 * n - 1));
+    EXPECT_DOUBLE_EQ(pl.area(), double(n) * (2 * n - 1) / 2);
+}
+
 TEST(polygonTest, insideTest) {
     Polygon pl = {Point(5.0, 2.0),
                   Point(4.0, -1.0),
@@ -125,6 +139,84 @@ TEST(polygonTest, issimpleTest) {
     EXPECT_TRUE(pl12.is_simple());
 }
 
+TEST(polygonTest, selfIntersectionTest) {
+    Polygon pl1 = {Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0)};
+    EXPECT_FALSE(pl1.self_intersection());
+    // 辺 0 と辺 2 が交わる蝶ネクタイ形
+    Polygon pl2  = {Point(0.0, 0.0),
+                    Point(2.0, 2.0),
+                    Point(2.0, 0.0),
+                    Point(0.0, 2.0)};
+    auto    res2 = pl2.self_intersection();
+    ASSERT_TRUE(res2);
+    EXPECT_EQ(res2->first, 0u);
+    EXPECT_EQ(res2->second, 2u);
+    // 頂点が他の辺に接する
+    Polygon pl3  = {Point(0.0, 0.0),
+                    Point(4.0, 0.0),
+                    Point(4.0, 4.0),
+                    Point(2.0, 0.0),
+                    Point(0.0, 4.0)};
+    auto    res3 = pl3.self_intersection();
+    ASSERT_TRUE(res3);
+    EXPECT_EQ(res3->first, 0u);
+    EXPECT_EQ(res3->second, 2u);
+}
+
+TEST(polygonTest, sweepSimpleTest) {
+    // O(n^2) で調べる
+    auto brute = [](const std::vector<Point> &v) {
+        const size_t n = v.size();
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = i + 2; j < n; j++) {
+                if (i == 0 && j == n - 1) continue;
+                if (intersection(Segment(v[i], v[i + 1]),
+                                 Segment(v[j], v[(j + 1) % n]))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    std::mt19937                     rng(1);
+    std::uniform_real_distribution<> unit(0.5, 1.0);
+    std::uniform_int_distribution<>  lattice(0, 6);
+    for (size_t n : {32, 50, 200, 500}) {
+        // 星形多角形は単純で，2頂点を入れ替えると大抵は単純でなくなる
+        std::vector<Point> star(n);
+        for (size_t i = 0; i < n; i++) {
+            star[i] = Point::polar(2 * PI * i / n, unit(rng));
+        }
+        EXPECT_TRUE(Polygon(star).is_simple());
+        for (int t = 0; t < 20; t++) {
+            std::vector<Point> v = star;
+            std::swap(v[rng() % n], v[rng() % n]);
+            EXPECT_EQ(Polygon(v).is_simple(), brute(v));
+        }
+        // 格子点上の頂点は縮退した交差を多く含む
+        for (int t = 0; t < 20; t++) {
+            std::vector<Point> v(n);
+            for (Point &p : v) p = Point(lattice(rng), lattice(rng));
+            EXPECT_EQ(Polygon(v).is_simple(), brute(v));
+        }
+    }
+    // 格子点上の単純な櫛形
+    std::vector<Point> comb;
+    for (int i = 0; i < 40; i++) {
+        comb.emplace_back(2 * i, 0);
+        comb.emplace_back(2 * i, 5);
+        comb.emplace_back(2 * i + 1, 5);
+        comb.emplace_back(2 * i + 1, 1);
+    }
+    comb.emplace_back(80, 1);
+    comb.emplace_back(80, -1);
+    comb.emplace_back(0, -1);
+    EXPECT_TRUE(brute(comb));
+    EXPECT_TRUE(Polygon(comb).is_simple());
+    comb.back() = Point(40, 3);
+    EXPECT_EQ(Polygon(comb).is_simple(), brute(comb));
+}
+
 TEST(polygonTest, isConvexTest) {
     auto rotate = [](std::vector<Point> v) {
         v.emplace_back(v[0]);
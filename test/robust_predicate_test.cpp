@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <point.hpp>
+#include <robust_predicate.hpp>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+TEST(robustPredicateTest, orient2dTest) {
+    Point o(0.0, 0.0), p(1.0, 0.0), q(0.0, 1.0);
+    EXPECT_GT(robust::orient2d(o, p, q), 0.0);
+    EXPECT_LT(robust::orient2d(o, q, p), 0.0);
+    Point a(0.5, 0.5), b(12.0, 12.0), c(24.0, 24.0);
+    EXPECT_EQ(robust::orient2d(a, b, c), 0.0);
+    // (0.5 + d, 0.5), (12, 12), (24, 24) の向きは -12d の符号で決まる
+    a.x(nextafter(0.5, 1.0));
+    EXPECT_LT(robust::orient2d(a, b, c), 0.0);
+    a.x(nextafter(0.5, 0.0));
+    EXPECT_GT(robust::orient2d(a, b, c), 0.0);
+}
+
+TEST(robustPredicateTest, orient2dNearColinearTest) {
+    // 浮動小数点数での計算が破綻する小さな摂動も正しく判定する
+    Point b(12.0, 12.0), c(24.0, 24.0);
+    Real  ulp = nextafter(0.5, 1.0) - 0.5;
+    for (int i = -8; i <= 8; i++) {
+        for (int j = -8; j <= 8; j++) {
+            Point a(0.5 + i * ulp, 0.5 + j * ulp);
+            Real  det = robust::orient2d(a, b, c);
+            // 厳密な値は 12 * ulp * (j - i)
+            EXPECT_EQ((det > 0) - (det < 0), (j > i) - (j < i));
+        }
+    }
+}
+
+TEST(robustPredicateTest, incircleTest) {
+    Point a(1.0, 0.0), b(0.0, 1.0), c(-1.0, 0.0);
+    EXPECT_EQ(robust::incircle(a, b, c, Point(0.0, -1.0)), 0.0);
+    EXPECT_GT(robust::incircle(a, b, c, Point(0.0, 0.0)), 0.0);
+    EXPECT_LT(robust::incircle(a, b, c, Point(2.0, 2.0)), 0.0);
+    EXPECT_GT(robust::incircle(a, b, c, Point(0.0, nextafter(-1.0, 0.0))), 0.0);
+    EXPECT_LT(robust::incircle(a, b, c, Point(0.0, nextafter(-1.0, -2.0))),
+              0.0);
+    EXPECT_LT(robust::incircle(c, b, a, Point(0.0, 0.0)), 0.0);
+}
+
+TEST(robustPredicateTest, incircleLargeCoordinateTest) {
+    // 座標が大きいと EPS による判定は使えない
+    Real  o = 1e9;
+    Point a(o + 1.0, o), b(o, o + 1.0), c(o - 1.0, o);
+    EXPECT_EQ(robust::incircle(a, b, c, Point(o, o - 1.0)), 0.0);
+    EXPECT_GT(robust::incircle(a, b, c, Point(o, o - 0.5)), 0.0);
+    EXPECT_LT(robust::incircle(a, b, c, Point(o + 1.0, o - 1.0)), 0.0);
+}
+
+TEST(robustPredicateTest, incircleInexactDifferenceTest) {
+    // 等脚台形の頂点は同一円周上にある。y 座標の差は double で表せない
+    // ので，誤差の項まで調べないと符号が決まらない
+    Real  y1 = 1e6 + 0.1, y2 = 1e-9;
+    Point a(0.25, y1), b(0.5, y1), c(0.125, y2);
+    Real  x = 0.625;
+    EXPECT_EQ(robust::incircle(b, a, c, Point(x, y2)), 0.0);
+    EXPECT_GT(robust::incircle(b, a, c, Point(nextafter(x, 0.0), y2)), 0.0);
+    EXPECT_LT(robust::incircle(b, a, c, Point(nextafter(x, 1.0), y2)), 0.0);
+    EXPECT_GT(robust::incircle(b, a, c, Point(x, nextafter(y2, 1.0))), 0.0);
+    EXPECT_LT(robust::incircle(b, a, c, Point(x, nextafter(y2, 0.0))), 0.0);
+}
+
+TEST(robustPredicateTest, ccwTest) {
+    Point a(0.0, 0.0), b(2.0, 2.0);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, Point(0.0, 2.0)), COUNTER_CLOCKWISE);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, Point(2.0, 0.0)), CLOCKWISE);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, Point(-1.0, -1.0)), ONLINE_BACK);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, Point(1.0, 1.0)), ON_SEGMENT);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, Point(2.0, 2.0)), ON_SEGMENT);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, Point(3.0, 3.0)), ONLINE_FRONT);
+    EXPECT_EQ(ccw<ExactPredicate>(b, a, Point(3.0, 3.0)), ONLINE_BACK);
+    EXPECT_EQ(ccw<ExactPredicate>(b, a, Point(-1.0, -1.0)), ONLINE_FRONT);
+    Point c(0.0, 0.0), d(0.0, -3.0);
+    EXPECT_EQ(ccw<ExactPredicate>(c, d, Point(0.0, 1.0)), ONLINE_BACK);
+    EXPECT_EQ(ccw<ExactPredicate>(c, d, Point(0.0, -1.0)), ON_SEGMENT);
+    EXPECT_EQ(ccw<ExactPredicate>(c, d, Point(0.0, -4.0)), ONLINE_FRONT);
+}
+
+TEST(robustPredicateTest, ccwSmallScaleTest) {
+    // EPS より小さい面積の三角形も向きを判定できる
+    Point a(0.0, 0.0), b(1e-6, 0.0), c(0.0, 1e-6);
+    EXPECT_EQ(ccw(a, b, c), ON_SEGMENT);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, c), COUNTER_CLOCKWISE);
+    EXPECT_FALSE(colinear<ExactPredicate>(a, b, c));
+}
+
+TEST(robustPredicateTest, circleFamilyTest) {
+    Point a(4.0, 3.0), b(3.0, -4.0), c(0.0, -5.0), d(-4.0, -3.0),
+        f(1.0, -3.0), g(7.0, 0.0);
+    EXPECT_TRUE(in_circle<ExactPredicate>(a, b, c, f));
+    EXPECT_TRUE(in_circle<ExactPredicate>(a, c, b, f));
+    EXPECT_FALSE(in_circle<ExactPredicate>(a, b, c, g));
+    EXPECT_TRUE(on_circle<ExactPredicate>(a, b, c, d));
+    EXPECT_FALSE(on_circle<ExactPredicate>(a, b, c, f));
+    EXPECT_TRUE(out_circle<ExactPredicate>(a, b, c, g));
+    EXPECT_TRUE(out_circle<ExactPredicate>(c, b, a, g));
+    EXPECT_FALSE(out_circle<ExactPredicate>(a, b, c, d));
+}
+
+TEST(robustPredicateTest, coordinateTypeTest) {
+    // float は double に変換して判定する
+    using PointF = BasicPoint<float>;
+    PointF a(0.0f, 0.0f), b(1e-4f, 0.0f), c(0.0f, 1e-4f);
+    EXPECT_EQ(ccw(a, b, c), ON_SEGMENT);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, c), COUNTER_CLOCKWISE);
+    EXPECT_EQ(ccw<ExactPredicate>(a, b, PointF(2e-4f, 0.0f)), ONLINE_FRONT);
+    EXPECT_TRUE(in_circle<ExactPredicate>(a, b, c, PointF(5e-5f, 5e-5f)));
+    EXPECT_TRUE(on_circle<ExactPredicate>(a, b, c, PointF(1e-4f, 1e-4f)));
+    // 整数は product_type と __int128 で判定する
+    using PointI = BasicPoint<int>;
+    PointI p(0, 0), q(60000, 0), r(0, 60000);
+    EXPECT_EQ(ccw<ExactPredicate>(p, q, r), COUNTER_CLOCKWISE);
+    EXPECT_EQ(ccw<ExactPredicate>(p, q, PointI(-1, 0)), ONLINE_BACK);
+    EXPECT_TRUE(out_circle<ExactPredicate>(p, q, r, PointI(120000, 120000)));
+    EXPECT_TRUE(in_circle<ExactPredicate>(r, q, p, PointI(30000, 30000)));
+    EXPECT_TRUE(on_circle<ExactPredicate>(p, q, r, PointI(60000, 60000)));
+    EXPECT_FALSE(in_circle<ExactPredicate>(p, q, PointI(1, 0), r));
+}
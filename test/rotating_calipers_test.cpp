@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <config.hpp>
+#include <convex_hull.hpp>
+#include <polygon.hpp>
+#include <random>
+#include <rotating_calipers.hpp>
+#include <tuple>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+using PointI   = BasicPoint<int>;
+using PolygonI = BasicPolygon<int>;
+
+// 辺 i の向きの外接長方形の (幅, 高さ) を全ての頂点を見て求める
+pair<Real, Real> brute_extent(const Polygon &pl, size_t i) {
+    const size_t n = pl.size();
+    Point        u = pl[(i + 1) % n] - pl[i];
+    u /= abs(u);
+    Real lo = 0, hi = 0, h = 0;
+    for (size_t k = 0; k < n; k++) {
+        lo = min(lo, dot(pl[k] - pl[i], u));
+        hi = max(hi, dot(pl[k] - pl[i], u));
+        h  = max(h, cross(u, pl[k] - pl[i]));
+    }
+    return {hi - lo, h};
+}
+
+}  // namespace
+
+TEST(rotatingCalipersTest, diameterTest) {
+    // CGL_4_B の入力例
+    Polygon p1 = {Point(0.0, 0.0), Point(4.0, 0.0), Point(2.0, 2.0)};
+    Polygon p2 = {
+        Point(0.0, 0.0), Point(1.0, 0.0), Point(1.0, 1.0), Point(0.0, 1.0)};
+    EXPECT_DOUBLE_EQ(get<2>(convex_diameter(p1)), 16.0);
+    EXPECT_DOUBLE_EQ(get<2>(convex_diameter(p2)), 2.0);
+    // 一直線上に頂点がある場合
+    PolygonI p3 = {PointI(0, 0),
+                   PointI(2, 0),
+                   PointI(4, 0),
+                   PointI(4, 2),
+                   PointI(4, 4),
+                   PointI(2, 4),
+                   PointI(0, 4),
+                   PointI(0, 2)};
+    auto [i, j, d] = convex_diameter(p3);
+    EXPECT_EQ(d, 32);
+    EXPECT_EQ(norm(p3[i] - p3[j]), d);
+}
+
+TEST(rotatingCalipersTest, rectangleTest) {
+    Polygon p = {Point(0.0, 0.0), Point(4.0, 0.0), Point(2.0, 2.0)};
+    EXPECT_DOUBLE_EQ(convex_width(p), 2.0);
+    Polygon r = min_area_rectangle(p);
+    EXPECT_EQ(r.size(), 4u);
+    EXPECT_NEAR(r.area(), 8.0, 1e-9);
+    // 正方形を回した菱形は自身が最小の長方形
+    PolygonI q = {PointI(0, -3), PointI(3, 0), PointI(0, 3), PointI(-3, 0)};
+    EXPECT_NEAR(min_area_rectangle(q).area(), 18.0, 1e-9);
+    EXPECT_NEAR(min_perimeter_rectangle(q).area(), 18.0, 1e-9);
+    EXPECT_NEAR(convex_width(q), sqrt(18.0), 1e-9);
+}
+
+TEST(rotatingCalipersTest, randomTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-100.0, 100.0);
+    for (int t = 0; t < 50; t++) {
+        vector<Point> points(3 + t);
+        for (Point &q : points) q = Point(unit(rng), unit(rng));
+        Polygon      pl = convex_hull(points, t % 2 == 0);
+        const size_t n  = pl.size();
+        Real         diam = 0, width = 1e18, area = 1e18, perimeter = 1e18;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = 0; j < n; j++) {
+                diam = max(diam, norm(pl[i] - pl[j]));
+            }
+            auto [w, h] = brute_extent(pl, i);
+            width       = min(width, h);
+            area        = min(area, w * h);
+            perimeter   = min(perimeter, 2 * (w + h));
+        }
+        auto [i, j, d] = convex_diameter(pl);
+        EXPECT_DOUBLE_EQ(d, diam);
+        EXPECT_DOUBLE_EQ(norm(pl[i] - pl[j]), d);
+        EXPECT_NEAR(convex_width(pl), width, 1e-6);
+        Polygon r1 = min_area_rectangle(pl), r2 = min_perimeter_rectangle(pl);
+        EXPECT_NEAR(r1.area(), area, 1e-6);
+        Real len = 0;
+        for (size_t k = 0; k < 4; k++) len += abs(r2[(k + 1) % 4] - r2[k]);
+        EXPECT_NEAR(len, perimeter, 1e-6);
+        // 長方形は多角形を含む
+        for (size_t k = 0; k < n; k++) {
+            EXPECT_TRUE(r1.inside(pl[k]) || r1.on_object(pl[k]));
+        }
+    }
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <config.hpp>
+#include <cross_point.hpp>
+#include <intersection.hpp>
+#include <random>
+#include <robust_predicate.hpp>
+#include <segment.hpp>
+#include <segment_intersection.hpp>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 全ての組を intersection で調べる
+template <class T>
+vector<pair<size_t, size_t>> brute_force(
+    const vector<BasicSegment<T>> &segments) {
+    vector<pair<size_t, size_t>> ret;
+    for (size_t i = 0; i < segments.size(); i++) {
+        for (size_t j = i + 1; j < segments.size(); j++) {
+            if (intersection(segments[i], segments[j])) ret.emplace_back(i, j);
+        }
+    }
+    return ret;
+}
+
+template <class Result>
+vector<pair<size_t, size_t>> pairs(const Result &res) {
+    vector<pair<size_t, size_t>> ret;
+    for (const auto &t : res) ret.emplace_back(get<0>(t), get<1>(t));
+    sort(begin(ret), end(ret));
+    return ret;
+}
+
+}  // namespace
+
+TEST(segmentIntersectionTest, degenerateTest) {
+    vector<Segment> s = {
+        Segment(Point(0.0, 0.0), Point(4.0, 4.0)),    // 0
+        Segment(Point(0.0, 4.0), Point(4.0, 0.0)),    // 1: 0 と (2, 2) で交差
+        Segment(Point(4.0, 4.0), Point(6.0, 4.0)),    // 2: 0 と端点で接する
+        Segment(Point(5.0, 4.0), Point(8.0, 4.0)),    // 3: 2 と重なる
+        Segment(Point(9.0, 4.0), Point(10.0, 4.0)),   // 4: 3 と同じ直線上
+        Segment(Point(7.0, 0.0), Point(7.0, 6.0)),    // 5: 3 と交差
+        Segment(Point(7.0, 1.0), Point(7.0, 1.0)),    // 6: 5 上の点
+        Segment(Point(2.0, -1.0), Point(2.0, 2.0)),   // 7: 0, 1 の交点で接する
+    };
+    auto res = segment_intersections(s);
+    ASSERT_EQ(res.size(), 7u);
+    sort(begin(res), end(res), [](const auto &a, const auto &b) {
+        return make_pair(get<0>(a), get<1>(a)) <
+               make_pair(get<0>(b), get<1>(b));
+    });
+    vector<tuple<size_t, size_t, Point>> expected = {
+        {0, 1, Point(2.0, 2.0)},
+        {0, 2, Point(4.0, 4.0)},
+        {0, 7, Point(2.0, 2.0)},
+        {1, 7, Point(2.0, 2.0)},
+        {2, 3, Point(5.0, 4.0)},
+        {3, 5, Point(7.0, 4.0)},
+        {5, 6, Point(7.0, 1.0)},
+    };
+    for (size_t k = 0; k < res.size(); k++) {
+        EXPECT_EQ(get<0>(res[k]), get<0>(expected[k]));
+        EXPECT_EQ(get<1>(res[k]), get<1>(expected[k]));
+        EXPECT_TRUE(get<2>(res[k]) == get<2>(expected[k]));
+    }
+}
+
+TEST(segmentIntersectionTest, randomTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(0.0, 100.0), len(-15.0, 15.0);
+    for (size_t n : {10, 100, 500}) {
+        vector<Segment> s;
+        for (size_t i = 0; i < n; i++) {
+            Point p(unit(rng), unit(rng));
+            s.emplace_back(p, p + Point(len(rng), len(rng)));
+        }
+        auto res = segment_intersections(s);
+        EXPECT_EQ(pairs(res), brute_force(s));
+        for (const auto &t : res) {
+            auto q = cross_point(s[get<0>(t)], s[get<1>(t)]);
+            ASSERT_EQ(q.size(), 1u);
+            EXPECT_NEAR(q[0].x(), get<2>(t).x(), 1e-6);
+            EXPECT_NEAR(q[0].y(), get<2>(t).y(), 1e-6);
+        }
+    }
+}
+
+TEST(segmentIntersectionTest, latticeTest) {
+    // 端点の共有，一直線上の重なり，垂直な辺が多く現れる
+    using SegmentI = BasicSegment<int>;
+    using PointI   = BasicPoint<int>;
+    mt19937                    rng(1);
+    uniform_int_distribution<> coord(0, 8);
+    for (int t = 0; t < 20; t++) {
+        vector<SegmentI> s;
+        while (s.size() < 60) {
+            PointI a(coord(rng), coord(rng)), b(coord(rng), coord(rng));
+            // intersection は長さ 0 の線分に対応していない
+            if (a != b) s.emplace_back(a, b);
+        }
+        EXPECT_EQ(pairs(segment_intersections(s)), brute_force(s));
+        EXPECT_EQ(pairs(segment_intersections<ExactPredicate>(s)),
+                  brute_force(s));
+    }
+}
+
+TEST(segmentIntersectionTest, callbackTest) {
+    // 格子状に並べた水平な辺と垂直な辺
+    const size_t    n = 50;
+    vector<Segment> s;
+    for (size_t i = 0; i < n; i++) {
+        s.emplace_back(Point(0.0, Real(i)), Point(Real(n), Real(i)));
+        s.emplace_back(Point(i + 0.5, -1.0), Point(i + 0.5, Real(n)));
+    }
+    size_t count = 0;
+    segment_intersections(s, [&](size_t i, size_t j, const Point &p) {
+        EXPECT_LT(i, j);
+        EXPECT_NE(i % 2, j % 2);
+        EXPECT_TRUE(s[i].on_object(p));
+        EXPECT_TRUE(s[j].on_object(p));
+        count++;
+    });
+    EXPECT_EQ(count, n * n);
+}
@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
 #include <config.hpp>
+#include <cstring>
 #include <segment.hpp>
+#include <vector>
 
 using namespace std;
 
@@ -180,4 +182,15 @@ TEST(segmentTest, rotateTest) {
     EXPECT_DOUBLE_EQ(sg3.x2(), -1.0);
     EXPECT_DOUBLE_EQ(sg3.y1(), 4.0);
     EXPECT_DOUBLE_EQ(sg3.y2(), 0.0);
-}
\ No newline at end of file
+}
+
+TEST(segmentTest, memcpyTest) {
+    vector<Segment> src = {Segment(Point(1.0, 2.0), Point(3.0, 4.0)),
+                           Segment(Point(-1.0, 0.5), Point(2.0, -7.0))};
+    vector<Segment> dst(src.size());
+    memcpy(dst.data(), src.data(), src.size() * sizeof(Segment));
+    for (size_t i = 0; i < src.size(); i++) {
+        EXPECT_EQ(dst[i].start(), src[i].start());
+        EXPECT_EQ(dst[i].end(), src[i].end());
+    }
+}
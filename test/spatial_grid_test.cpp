@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <config.hpp>
+#include <random>
+#include <spatial_grid.hpp>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+vector<size_t> brute_force(const vector<Point> &p, const Point &q, Real r) {
+    vector<size_t> ret;
+    for (size_t i = 0; i < p.size(); i++) {
+        if (le(norm(p[i] - q), r * r)) ret.push_back(i);
+    }
+    return ret;
+}
+
+vector<size_t> sorted(vector<size_t> v) {
+    sort(begin(v), end(v));
+    return v;
+}
+
+}  // namespace
+
+TEST(spatialGridTest, queryTest) {
+    vector<Point> p = {Point(0.0, 0.0),
+                       Point(1.0, 0.0),
+                       Point(-1.0, -1.0),
+                       Point(3.0, 3.0),
+                       Point(0.5, 0.5)};
+    SpatialGrid   grid(1.0, p);
+    EXPECT_EQ(grid.size(), 5u);
+    EXPECT_EQ(sorted(grid.within_radius(Point(0.0, 0.0), 1.0)),
+              vector<size_t>({0, 1, 4}));
+    EXPECT_EQ(sorted(grid.within_radius(Point(3.0, 2.0), 1.0)),
+              vector<size_t>({3}));
+    EXPECT_TRUE(grid.within_radius(Point(10.0, 10.0), 2.0).empty());
+    vector<pair<size_t, size_t>> pairs;
+    grid.for_each_pair_within(
+        1.0, [&](size_t i, size_t j) { pairs.emplace_back(i, j); });
+    sort(begin(pairs), end(pairs));
+    vector<pair<size_t, size_t>> expected = {{0, 1}, {0, 4}, {1, 4}};
+    EXPECT_EQ(pairs, expected);
+    SpatialGrid empty(1.0);
+    EXPECT_TRUE(empty.within_radius(Point(0.0, 0.0), 1.0).empty());
+}
+
+TEST(spatialGridTest, moveTest) {
+    // 毎回少しずつ動く点
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-50.0, 50.0), step(-0.3, 0.3);
+    vector<Point>               p(500), q(50);
+    for (Point &r : p) r = Point(unit(rng), unit(rng));
+    for (Point &r : q) r = Point(unit(rng), unit(rng));
+    SpatialGrid grid(2.0, p);
+    for (int tick = 0; tick < 20; tick++) {
+        for (size_t i = 0; i < p.size(); i++) {
+            if (rng() % 3 == 0) continue;
+            p[i] += Point(step(rng), step(rng));
+            grid.update(i, p[i]);
+        }
+        for (const Point &r : q) {
+            EXPECT_EQ(sorted(grid.within_radius(r, 3.0)),
+                      brute_force(p, r, 3.0));
+        }
+        for (size_t i = 0; i < p.size(); i++) EXPECT_TRUE(grid[i] == p[i]);
+    }
+    // 大きく動かしても正しい
+    for (size_t i = 0; i < p.size(); i++) {
+        p[i] = Point(unit(rng), unit(rng));
+        grid.update(i, p[i]);
+    }
+    for (const Point &r : q) {
+        EXPECT_EQ(sorted(grid.within_radius(r, 5.0)), brute_force(p, r, 5.0));
+    }
+}
+
+TEST(spatialGridTest, integerTest) {
+    using PointI = BasicPoint<int>;
+    vector<PointI>        p = {PointI(0, 0), PointI(3, 4), PointI(-3, -4)};
+    BasicSpatialGrid<int> grid(2.0, p);
+    EXPECT_EQ(sorted(grid.within_radius(PointI(0, 0), 5.0)),
+              vector<size_t>({0, 1, 2}));
+    EXPECT_EQ(sorted(grid.within_radius(PointI(6, 8), 5.0)),
+              vector<size_t>({1}));
+}
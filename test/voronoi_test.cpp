@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <config.hpp>
+#include <delaunay.hpp>
+#include <random>
+#include <robust_predicate.hpp>
+#include <vector>
+#include <voronoi.hpp>
+
+using namespace std;
+
+using namespace sapphre15::geometry;
+
+namespace {
+
+// 全ての領域の面積の和
+Real total_area(const Voronoi &v) {
+    Real ret = 0;
+    for (size_t i = 0; i < v.size(); i++) {
+        if (auto cell = v.polygon(i)) ret += cell->area();
+    }
+    return ret;
+}
+
+}  // namespace
+
+TEST(voronoiTest, circumcentersTest) {
+    mt19937                     rng(0);
+    uniform_real_distribution<> unit(-100.0, 100.0);
+    vector<Point>               p(200);
+    for (Point &q : p) q = Point(unit(rng), unit(rng));
+    Delaunay      d(p);
+    vector<Point> c = circumcenters(p, d);
+    ASSERT_EQ(c.size(), d.size());
+    for (size_t t = 0; t < d.size(); t++) {
+        auto v = d.triangle(t);
+        EXPECT_NEAR(distance(c[t], p[v[0]]), distance(c[t], p[v[1]]), 1e-6);
+        EXPECT_NEAR(distance(c[t], p[v[0]]), distance(c[t], p[v[2]]), 1e-6);
+    }
+}
+
+TEST(voronoiTest, randomTest) {
+    mt19937                     rng(1);
+    uniform_real_distribution<> unit(-100.0, 100.0), box(-150.0, 150.0);
+    vector<Point>               p(300);
+    for (Point &q : p) q = Point(unit(rng), unit(rng));
+    Voronoi v(p, Point(-150, -150), Point(150, 150));
+    ASSERT_EQ(v.size(), p.size());
+    ASSERT_EQ(v.offsets().size(), p.size() + 1);
+    EXPECT_EQ(v.offsets().back(), v.vertices().size());
+    EXPECT_NEAR(total_area(v), 300.0 * 300.0, 1e-6);
+    for (size_t i = 0; i < p.size(); i++) {
+        auto cell = v.polygon(i);
+        ASSERT_TRUE(cell);
+        EXPECT_TRUE(cell->inside(p[i]));
+        EXPECT_TRUE(cell->is_convex());
+    }
+    // 任意の点は最も近い点の領域に含まれる
+    for (int k = 0; k < 1000; k++) {
+        Point  q(box(rng), box(rng));
+        size_t best = 0;
+        for (size_t i = 1; i < p.size(); i++) {
+            if (norm(p[i] - q) < norm(p[best] - q)) best = i;
+        }
+        EXPECT_TRUE(v.polygon(best)->inside(q));
+    }
+}
+
+TEST(voronoiTest, latticeTest) {
+    // 同一円周上の点ばかりでも各領域は単位正方形になる
+    vector<Point> p;
+    for (int x = 0; x < 5; x++) {
+        for (int y = 0; y < 5; y++) p.emplace_back(x, y);
+    }
+    BasicDelaunay<Real, ExactPredicate> d(p);
+    Voronoi v(p, d, Point(-0.5, -0.5), Point(4.5, 4.5));
+    for (size_t i = 0; i < p.size(); i++) {
+        auto cell = v.polygon(i);
+        ASSERT_TRUE(cell);
+        EXPECT_EQ(v.offsets()[i + 1] - v.offsets()[i], 4u);
+        EXPECT_NEAR(cell->area(), 1.0, 1e-9);
+    }
+}
+
+TEST(voronoiTest, collinearTest) {
+    // 一直線上の点と重複する点
+    vector<Point> p = {
+        Point(0.0, 0.0), Point(1.0, 0.0), Point(3.0, 0.0), Point(1.0, 0.0)};
+    Voronoi v(p, Point(-1, -1), Point(5, 1));
+    EXPECT_NEAR(v.polygon(0)->area(), 3.0, 1e-9);
+    EXPECT_NEAR(v.polygon(2)->area(), 6.0, 1e-9);
+    EXPECT_NE(bool(v.polygon(1)), bool(v.polygon(3)));
+    EXPECT_NEAR(total_area(v), 12.0, 1e-9);
+    // 箱の外の領域は空になる
+    Voronoi w(p, Point(2.5, -1), Point(5, 1));
+    EXPECT_FALSE(w.polygon(0));
+    EXPECT_NEAR(w.polygon(2)->area(), 5.0, 1e-9);
+}